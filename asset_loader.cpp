@@ -0,0 +1,38 @@
+#include "asset_loader.hpp"
+
+namespace {
+
+template <typename Asset>
+std::thread decodeInBackground(Asset& asset, const char* path, const AssetPack* pack, std::atomic<int>& completed) {
+    return std::thread([&asset, path, pack, &completed]() {
+        loadAsset(asset, path, pack);
+        completed.fetch_add(1, std::memory_order_release);
+    });
+}
+
+}
+
+AssetLoader::AssetLoader() : completed(0), total(0) {}
+
+AssetLoader::~AssetLoader() { join(); }
+
+void AssetLoader::start(const AssetPack* pack) {
+    workers.push_back(decodeInBackground(assets.background, "background.jpeg", pack, completed));
+    workers.push_back(decodeInBackground(assets.player, "player.png", pack, completed));
+    workers.push_back(decodeInBackground(assets.enemy, "enemy.png", pack, completed));
+    workers.push_back(decodeInBackground(assets.zone, "zone_fire.png", pack, completed));
+    workers.push_back(decodeInBackground(assets.gameOver, "gameover.jpg", pack, completed));
+    workers.push_back(decodeInBackground(assets.shoot, "shoot.wav", pack, completed));
+    total = static_cast<int>(workers.size());
+}
+
+void AssetLoader::join() {
+    for (std::thread& worker : workers) {
+        if (worker.joinable()) worker.join();
+    }
+}
+
+DecodedAssets& AssetLoader::finish() {
+    join();
+    return assets;
+}
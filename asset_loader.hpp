@@ -0,0 +1,46 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "asset_pack.hpp"
+
+// CPU-side game assets: decoded pixels and samples, not yet on the GPU.
+struct DecodedAssets {
+    sf::Image background;
+    sf::Image player;
+    sf::Image enemy;
+    sf::Image zone;
+    sf::Image gameOver;
+    sf::SoundBuffer shoot;
+};
+
+// Decodes every asset in parallel, one worker thread per file, so start-up
+// costs the slowest decode instead of the sum of all of them. Assets come
+// from the mapped asset pack when one is given and holds them, and from
+// loose files otherwise. The render thread polls isReady() between frames
+// and creates the textures itself once everything is decoded, since GPU
+// uploads must stay on that thread.
+class AssetLoader {
+private:
+    DecodedAssets assets;
+    std::vector<std::thread> workers;
+    std::atomic<int> completed;
+    int total;
+
+    void join();
+
+public:
+    AssetLoader();
+    ~AssetLoader();
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    void start(const AssetPack* pack = nullptr);
+    int getCompleted() const { return completed.load(std::memory_order_acquire); }
+    int getTotal() const { return total; }
+    bool isReady() const { return getCompleted() == total; }
+    // Waits for the workers and hands over the decoded assets.
+    DecodedAssets& finish();
+};
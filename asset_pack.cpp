@@ -0,0 +1,145 @@
+#include "asset_pack.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace {
+
+std::string packEntryName(const PackEntry& entry) {
+    return std::string(entry.name, strnlen(entry.name, PACK_NAME_SIZE));
+}
+
+std::string baseName(const std::string& path) {
+    std::size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+std::size_t alignUp(std::size_t value) {
+    return (value + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT * PACK_ALIGNMENT;
+}
+
+}
+
+AssetPack::AssetPack() : entries(nullptr), count(0) {}
+
+bool AssetPack::open(const std::string& path) {
+    entries = nullptr;
+    count = 0;
+    if (!file.open(path)) return false;
+
+    const PackHeader* header = reinterpret_cast<const PackHeader*>(file.data());
+    bool valid = file.size() >= sizeof(PackHeader) &&
+                 std::memcmp(header->magic, PACK_MAGIC, sizeof(PACK_MAGIC)) == 0 &&
+                 header->version == PACK_VERSION &&
+                 header->count <= (file.size() - sizeof(PackHeader)) / sizeof(PackEntry);
+    if (valid) {
+        const PackEntry* index = reinterpret_cast<const PackEntry*>(file.data() + sizeof(PackHeader));
+        for (std::uint32_t i = 0; i < header->count && valid; ++i)
+            valid = index[i].offset <= file.size() && index[i].size <= file.size() - index[i].offset;
+        if (valid) {
+            entries = index;
+            count = header->count;
+        }
+    }
+    if (!valid) {
+        std::cerr << path << " is not a valid asset pack\n";
+        file.close();
+    }
+    return valid;
+}
+
+AssetBlob AssetPack::find(const std::string& name) const {
+    AssetBlob blob;
+    const PackEntry* end = entries + count;
+    const PackEntry* it = std::lower_bound(entries, end, name, [](const PackEntry& entry, const std::string& key) {
+        return packEntryName(entry) < key;
+    });
+    if (it != end && packEntryName(*it) == name) {
+        blob.data = file.data() + it->offset;
+        blob.size = static_cast<std::size_t>(it->size);
+    }
+    return blob;
+}
+
+std::string AssetPack::getName(std::uint32_t i) const {
+    return packEntryName(entries[i]);
+}
+
+std::vector<std::string> AssetPack::verify() const {
+    std::vector<std::string> corrupt;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (crc32(file.data() + entries[i].offset, static_cast<std::size_t>(entries[i].size)) != entries[i].crc32)
+            corrupt.push_back(packEntryName(entries[i]));
+    }
+    return corrupt;
+}
+
+bool writeAssetPack(const std::string& outputPath, const std::vector<std::string>& inputPaths) {
+    struct Input {
+        std::string name;
+        std::vector<char> bytes;
+    };
+
+    std::vector<Input> inputs;
+    for (const std::string& path : inputPaths) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            std::cerr << "Cannot read " << path << "\n";
+            return false;
+        }
+        Input input;
+        input.name = baseName(path);
+        if (input.name.size() >= PACK_NAME_SIZE) {
+            std::cerr << "Asset name too long for the pack index: " << input.name << "\n";
+            return false;
+        }
+        input.bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        inputs.push_back(std::move(input));
+    }
+    std::sort(inputs.begin(), inputs.end(), [](const Input& a, const Input& b) { return a.name < b.name; });
+    for (std::size_t i = 1; i < inputs.size(); ++i) {
+        if (inputs[i].name == inputs[i - 1].name) {
+            std::cerr << "Duplicate asset name: " << inputs[i].name << "\n";
+            return false;
+        }
+    }
+
+    PackHeader header = {};
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = PACK_VERSION;
+    header.count = static_cast<std::uint32_t>(inputs.size());
+
+    std::vector<PackEntry> index(inputs.size());
+    std::size_t offset = alignUp(sizeof(PackHeader) + sizeof(PackEntry) * inputs.size());
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        PackEntry& entry = index[i];
+        std::memset(&entry, 0, sizeof(entry));
+        std::memcpy(entry.name, inputs[i].name.data(), inputs[i].name.size());
+        entry.crc32 = crc32(inputs[i].bytes.data(), inputs[i].bytes.size());
+        entry.offset = offset;
+        entry.size = inputs[i].bytes.size();
+        offset = alignUp(offset + inputs[i].bytes.size());
+    }
+
+    std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Cannot write " << outputPath << "\n";
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(index.data()), sizeof(PackEntry) * index.size());
+    std::size_t written = sizeof(PackHeader) + sizeof(PackEntry) * index.size();
+    const char padding[PACK_ALIGNMENT] = {};
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        out.write(padding, index[i].offset - written);
+        out.write(inputs[i].bytes.data(), inputs[i].bytes.size());
+        written = index[i].offset + inputs[i].bytes.size();
+    }
+    if (!out) {
+        std::cerr << "Failed writing " << outputPath << "\n";
+        return false;
+    }
+    return true;
+}
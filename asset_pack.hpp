@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "crc32.hpp"
+#include "mapped_file.hpp"
+
+// Single-file asset archive, read through one memory mapping so SFML can
+// decode straight from the mapped bytes with loadFromMemory.
+//
+// Layout (little-endian):
+//   PackHeader
+//   PackEntry[count]         the index, sorted by name
+//   blobs                    each starting on a PACK_ALIGNMENT boundary
+// Every entry carries a CRC-32 of its blob so a pack can be verified.
+
+const char PACK_MAGIC[4] = {'H', 'D', 'P', 'K'};
+const std::uint32_t PACK_VERSION = 1;
+const std::size_t PACK_ALIGNMENT = 16;
+const std::size_t PACK_NAME_SIZE = 44;
+
+struct PackHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t count;
+    std::uint32_t reserved;
+};
+
+struct PackEntry {
+    char name[PACK_NAME_SIZE];
+    std::uint32_t crc32;
+    std::uint64_t offset;
+    std::uint64_t size;
+};
+
+static_assert(sizeof(PackHeader) == 16, "PackHeader must match the on-disk layout");
+static_assert(sizeof(PackEntry) == 64, "PackEntry must match the on-disk layout");
+
+struct AssetBlob {
+    const void* data = nullptr;
+    std::size_t size = 0;
+};
+
+class AssetPack {
+private:
+    MappedFile file;
+    const PackEntry* entries;
+    std::uint32_t count;
+
+public:
+    AssetPack();
+
+    // Maps the pack and checks the header and index; blobs are not touched.
+    bool open(const std::string& path);
+    bool isOpen() const { return file.isOpen(); }
+
+    // The named blob, or an empty one if the pack does not have it.
+    AssetBlob find(const std::string& name) const;
+    // Recomputes every CRC; returns the names that do not match.
+    std::vector<std::string> verify() const;
+
+    std::uint32_t getCount() const { return count; }
+    const PackEntry& getEntry(std::uint32_t i) const { return entries[i]; }
+    std::string getName(std::uint32_t i) const;
+};
+
+// Writes files into a new pack at outputPath, stored under their base names.
+// Reports problems on stderr and returns false.
+bool writeAssetPack(const std::string& outputPath, const std::vector<std::string>& inputPaths);
+
+// Loads an SFML resource (sf::Image, sf::Font, sf::SoundBuffer, ...) from the
+// pack if it has the file, straight out of the mapping, else from disk. For
+// fonts the pack must stay open for as long as the font is used.
+template <typename Resource>
+bool loadAsset(Resource& resource, const std::string& name, const AssetPack* pack) {
+    if (pack) {
+        AssetBlob blob = pack->find(name);
+        if (blob.data) return resource.loadFromMemory(blob.data, blob.size);
+    }
+    return resource.loadFromFile(name);
+}
@@ -0,0 +1,60 @@
+#include "audio_mixer.hpp"
+#include <cmath>
+#include "geometry.hpp"
+
+namespace {
+
+const float MIN_AUDIBLE_VOLUME = 1.0f;
+
+}
+
+AudioMixer::AudioMixer(SoundQueue& queue, float audibleDistance)
+    : queue(queue), playCount(0), audibleDistance(audibleDistance) {}
+
+void AudioMixer::setSound(SoundId id, const sf::SoundBuffer& buffer, int priority, float volume, float pitch) {
+    SoundDef& def = sounds[static_cast<int>(id)];
+    def.buffer = &buffer;
+    def.priority = priority;
+    def.volume = volume;
+    def.pitch = pitch;
+}
+
+AudioMixer::Voice* AudioMixer::acquireVoice(int priority) {
+    Voice* victim = nullptr;
+    for (Voice& voice : voices) {
+        if (voice.sound.getStatus() == sf::Sound::Stopped) return &voice;
+        if (!victim || voice.priority < victim->priority ||
+            (voice.priority == victim->priority && voice.startedAt < victim->startedAt))
+            victim = &voice;
+    }
+    return victim->priority <= priority ? victim : nullptr;
+}
+
+void AudioMixer::update(float listenerX, float listenerY) {
+    SoundEvent event;
+    while (queue.pop(event)) {
+        const SoundDef& def = sounds[static_cast<int>(event.id)];
+        if (!def.buffer) continue;
+        if (!pointInCircle(event.x, event.y, listenerX, listenerY, audibleDistance)) continue;
+
+        float distance = std::sqrt(distanceSquared(event.x, event.y, listenerX, listenerY));
+        float volume = def.volume * (1.0f - distance / audibleDistance);
+        if (volume < MIN_AUDIBLE_VOLUME) continue;
+
+        Voice* voice = acquireVoice(def.priority);
+        if (!voice) continue;
+        voice->sound.stop();
+        voice->sound.setBuffer(*def.buffer);
+        voice->sound.setVolume(volume);
+        voice->sound.setPitch(def.pitch);
+        voice->sound.play();
+        voice->priority = def.priority;
+        voice->startedAt = ++playCount;
+    }
+}
+
+void AudioMixer::stopAll() {
+    SoundEvent event;
+    while (queue.pop(event)) {}
+    for (Voice& voice : voices) voice.sound.stop();
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <cstdint>
+#include "sound_event.hpp"
+
+// Plays SoundEvents through a fixed pool of voices. Events too far from the
+// listener are dropped before they take a voice, nearer ones are attenuated
+// with distance. When every voice is busy the new sound steals the oldest
+// voice of the lowest priority, provided that is not above its own;
+// otherwise the new sound is dropped.
+class AudioMixer {
+public:
+    static const int VOICES = 16;
+
+private:
+    struct SoundDef {
+        const sf::SoundBuffer* buffer = nullptr;
+        int priority = 0;
+        float volume = 100.0f;
+        float pitch = 1.0f;
+    };
+
+    struct Voice {
+        sf::Sound sound;
+        int priority = 0;
+        std::uint64_t startedAt = 0;
+    };
+
+    SoundQueue& queue;
+    SoundDef sounds[SOUND_IDS];
+    Voice voices[VOICES];
+    std::uint64_t playCount;
+    float audibleDistance;
+
+    Voice* acquireVoice(int priority);
+
+public:
+    AudioMixer(SoundQueue& queue, float audibleDistance);
+
+    void setSound(SoundId id, const sf::SoundBuffer& buffer, int priority, float volume = 100.0f, float pitch = 1.0f);
+    // Drains the queue, once per frame on the thread that owns the audio device.
+    void update(float listenerX, float listenerY);
+    // Drops pending events and silences every voice.
+    void stopAll();
+};
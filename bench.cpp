@@ -0,0 +1,244 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "config.hpp"
+#include "enemy_store.hpp"
+#include "geometry.hpp"
+#include "hud.hpp"
+#include "random.hpp"
+#include "spatial_hash.hpp"
+#include "steering.hpp"
+#include "thread_pool.hpp"
+#include "world.hpp"
+
+// Microbenchmarks for the simulation's hot paths, built with `make bench`.
+// Every benchmark runs at entity counts from 10 to 1,000,000 and reports ns
+// per entity; `bench --json FILE` also writes the results for tracking.
+
+namespace {
+
+const std::size_t COUNTS[] = {10, 100, 1000, 10000, 100000, 1000000};
+// Each measurement processes about this many entities in total
+const double TARGET_ENTITIES = 2e7;
+
+struct Result {
+    std::string name;
+    std::size_t count;
+    double nsPerEntity;
+};
+
+std::vector<Result> results;
+volatile long long sink;
+
+typedef std::chrono::steady_clock Clock;
+
+double elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+void record(const std::string& name, std::size_t count, double nsPerEntity) {
+    Result result = {name, count, nsPerEntity};
+    results.push_back(result);
+    std::printf("%-20s %9zu %10.3f ns/entity\n", name.c_str(), count, nsPerEntity);
+}
+
+// Runs pass (which handles all count entities once) after one warm-up pass,
+// enough times to reach TARGET_ENTITIES, and records ns per entity.
+template <typename Pass>
+void measure(const char* name, std::size_t count, Pass pass) {
+    long long repeats = std::max(1LL, static_cast<long long>(TARGET_ENTITIES / count));
+    pass();
+    Clock::time_point start = Clock::now();
+    for (long long r = 0; r < repeats; ++r) pass();
+    record(name, count, elapsedNs(start) / (double(count) * repeats));
+}
+
+struct Points {
+    std::vector<float> x, y;
+};
+
+Points makePoints(std::size_t count, std::uint64_t seed) {
+    Points p;
+    p.x.resize(count);
+    p.y.resize(count);
+    Random random(seed);
+    for (std::size_t i = 0; i < count; ++i) {
+        p.x[i] = static_cast<float>(random.nextBelow(WINDOW_WIDTH));
+        p.y[i] = static_cast<float>(random.nextBelow(WINDOW_HEIGHT));
+    }
+    return p;
+}
+
+void fillEnemies(EnemyStore& enemies, const Points& p) {
+    enemies.clear();
+    for (std::size_t i = 0; i < p.x.size(); ++i) enemies.spawn(p.x[i], p.y[i], ENEMY_SPEED * (1.0f + (i % 20) / 10.0f), ENEMY_HEALTH);
+}
+
+void benchSteering(std::size_t count, const Points& p) {
+    std::vector<float> speed(count), scalarVx(count), scalarVy(count), simdVx(count), simdVy(count);
+    for (std::size_t i = 0; i < count; ++i) speed[i] = ENEMY_SPEED * (1.0f + (i % 20) / 10.0f);
+
+    measure("steer.scalar", count, [&] {
+        steerTowardsScalar(p.x.data(), p.y.data(), speed.data(), scalarVx.data(), scalarVy.data(), count, 600.0f, 350.0f);
+    });
+    measure((std::string("steer.") + steeringKernelName()).c_str(), count, [&] {
+        steerTowards(p.x.data(), p.y.data(), speed.data(), simdVx.data(), simdVy.data(), count, 600.0f, 350.0f);
+    });
+    if (std::memcmp(scalarVx.data(), simdVx.data(), count * sizeof(float)) != 0 ||
+        std::memcmp(scalarVy.data(), simdVy.data(), count * sizeof(float)) != 0)
+        std::printf("  steering kernels DIFFER from the scalar path\n");
+}
+
+// One enemy tick as World runs it: steer towards the player, then integrate,
+// serially and in chunks on the thread pool.
+void benchEnemyUpdate(std::size_t count, const Points& p, ThreadPool& pool) {
+    EnemyStore enemies;
+    enemies.allocate(count);
+    fillEnemies(enemies, p);
+    auto updateRange = [&](std::size_t begin, std::size_t end) {
+        enemies.steer(600.0f, 350.0f, begin, end);
+        enemies.integrate(SIM_STEP, begin, end);
+    };
+    measure("enemy.update", count, [&] { updateRange(0, count); });
+    measure("enemy.update.pool", count, [&] { pool.parallelFor(count, ENEMY_UPDATE_CHUNK, updateRange); });
+}
+
+// Bullet movement plus off-screen culling, as in World::updateBullets. The
+// pool drains as bullets leave, so it is refilled between timed batches and
+// the cost is divided by the bullets actually processed.
+void benchBullets(std::size_t count) {
+    FixedPool<Bullet> bullets(count);
+    Random random(2);
+    long long processed = 0;
+    double ns = 0;
+    while (processed < TARGET_ENTITIES) {
+        while (!bullets.full()) {
+            float angle = random.nextFloat() * 6.2831853f;
+            bullets.spawn(static_cast<float>(random.nextBelow(WINDOW_WIDTH)), static_cast<float>(random.nextBelow(WINDOW_HEIGHT)),
+                          std::cos(angle), std::sin(angle));
+        }
+        Clock::time_point start = Clock::now();
+        for (int tick = 0; tick < 30; ++tick) {
+            processed += bullets.size();
+            for (std::size_t i = 0; i < bullets.size(); ) {
+                bullets[i].move(SIM_STEP);
+                sf::Vector2f pos = bullets[i].getPosition();
+                if (pos.x < 0 || pos.x > WINDOW_WIDTH || pos.y < 0 || pos.y > WINDOW_HEIGHT) bullets.removeAt(i);
+                else ++i;
+            }
+        }
+        ns += elapsedNs(start);
+    }
+    record("bullet.move_cull", count, ns / processed);
+}
+
+// Grid rebuild over count enemies plus a full magazine of bullets querying
+// it, as in World::resolveCollisions; reported per enemy.
+void benchCollision(std::size_t count, const Points& p) {
+    Points shots = makePoints(MAX_BULLETS, 3);
+    SpatialHash grid(COLLISION_CELL_SIZE, WINDOW_WIDTH, WINDOW_HEIGHT);
+    grid.reserve(count);
+    measure("collision", count, [&] {
+        grid.build(p.x.data(), p.y.data(), count);
+        long long hits = 0;
+        for (int b = 0; b < MAX_BULLETS; ++b) {
+            int target = -1;
+            grid.query(shots.x[b], shots.y[b], BULLET_RADIUS + ENEMY_HIT_RADIUS, [&](int i) {
+                if (target >= 0 && i > target) return;
+                if (circlesOverlap(shots.x[b], shots.y[b], BULLET_RADIUS, p.x[i], p.y[i], ENEMY_HIT_RADIUS)) target = i;
+            });
+            hits += target >= 0;
+        }
+        sink = sink + hits;
+    });
+}
+
+// The same circle test with and without the square root, which the
+// simulation's distance checks dropped in favour of squared distances.
+void benchDistance(std::size_t count, const Points& p) {
+    const float cx = 600, cy = 350, radius = 300;
+    long long sqrtHits = 0, squaredHits = 0;
+    measure("distance.sqrt", count, [&] {
+        long long hits = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            float dx = p.x[i] - cx, dy = p.y[i] - cy;
+            hits += std::sqrt(dx * dx + dy * dy) < radius;
+        }
+        sqrtHits = hits;
+    });
+    measure("distance.squared", count, [&] {
+        long long hits = 0;
+        for (std::size_t i = 0; i < count; ++i) hits += pointInCircle(p.x[i], p.y[i], cx, cy, radius);
+        squaredHits = hits;
+    });
+    if (sqrtHits != squaredHits) std::printf("  distance checks DIFFER: %lld vs %lld hits\n", sqrtHits, squaredHits);
+}
+
+void benchZone(std::size_t count, const Points& p) {
+    SafeZone zone;
+    measure("zone.isInside", count, [&] {
+        long long inside = 0;
+        for (std::size_t i = 0; i < count; ++i) inside += zone.isInside(sf::Vector2f(p.x[i], p.y[i]));
+        sink = sink + inside;
+    });
+}
+
+void benchHud(std::size_t count) {
+    char buffer[HUD_BUFFER_SIZE];
+    measure("hud.format", count, [&] {
+        long long length = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            int value = static_cast<int>(i);
+            length += formatHudLine(buffer, value * 10, value, 100 - value % 100) - buffer;
+        }
+        sink = sink + length;
+    });
+}
+
+bool writeJson(const char* path, unsigned threads) {
+    std::FILE* out = std::fopen(path, "w");
+    if (!out) return false;
+    std::fprintf(out, "{\n  \"steering_kernel\": \"%s\",\n  \"threads\": %u,\n  \"results\": [\n", steeringKernelName(), threads);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        std::fprintf(out, "    {\"name\": \"%s\", \"count\": %zu, \"ns_per_entity\": %.4f}%s\n", results[i].name.c_str(),
+                     results[i].count, results[i].nsPerEntity, i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+    return std::fclose(out) == 0;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    const char* jsonPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonPath = argv[++i];
+        else {
+            std::fprintf(stderr, "usage: %s [--json FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    ThreadPool pool;
+    std::printf("%u threads\n", pool.getThreadCount());
+    for (std::size_t count : COUNTS) {
+        Points p = makePoints(count, 1);
+        benchSteering(count, p);
+        benchEnemyUpdate(count, p, pool);
+        benchBullets(count);
+        benchCollision(count, p);
+        benchDistance(count, p);
+        benchZone(count, p);
+        benchHud(count);
+    }
+
+    if (jsonPath && !writeJson(jsonPath, pool.getThreadCount())) {
+        std::fprintf(stderr, "Could not write %s\n", jsonPath);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+const int WINDOW_WIDTH = 1200;
+const int WINDOW_HEIGHT = 700;
+
+// The simulation advances in fixed ticks regardless of the display rate.
+const int SIM_TICK_RATE = 60;
+const float SIM_STEP = 1.0f / SIM_TICK_RATE;
+const float MAX_FRAME_TIME = 0.25f;
+
+// Speeds are in pixels per second, the shrink rate in radius pixels per second.
+const float PLAYER_SPEED = 180.0f;
+const float ENEMY_SPEED = 60.0f;
+const float BULLET_SPEED = 420.0f;
+const float BULLET_RADIUS = 5.0f;
+const float SAFE_ZONE_SHRINK_RATE = 6.0f;
+const float BULLET_COOLDOWN = 0.3f;
+const int MAX_BULLETS = 64;
+
+const int ENEMY_HEALTH = 50;
+const int INITIAL_ENEMIES = 5;
+const int MAX_ENEMIES = 10;
+const float ENEMY_SPAWN_INTERVAL = 3.0f;
+const float ENEMY_HIT_RADIUS = 12.0f;
+const float PLAYER_CONTACT_RADIUS = 20.0f;
+const float COLLISION_CELL_SIZE = 64.0f;
+// Enemies per thread pool task; fewer enemies than this update inline
+const int ENEMY_UPDATE_CHUNK = 8192;
+const float AUDIBLE_DISTANCE = 900.0f;
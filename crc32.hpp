@@ -0,0 +1,6 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Standard CRC-32 (IEEE 802.3), used to check pack entries and log records.
+std::uint32_t crc32(const void* data, std::size_t size);
@@ -0,0 +1,81 @@
+#include "enemy_store.hpp"
+#include "steering.hpp"
+
+void EnemyStore::allocate(std::size_t maxEnemies) {
+    capacity = maxEnemies;
+    x.reserve(capacity);
+    y.reserve(capacity);
+    prevX.reserve(capacity);
+    prevY.reserve(capacity);
+    vx.reserve(capacity);
+    vy.reserve(capacity);
+    speed.reserve(capacity);
+    health.reserve(capacity);
+}
+
+void EnemyStore::clear() {
+    x.clear();
+    y.clear();
+    prevX.clear();
+    prevY.clear();
+    vx.clear();
+    vy.clear();
+    speed.clear();
+    health.clear();
+}
+
+bool EnemyStore::spawn(float px, float py, float enemySpeed, int enemyHealth) {
+    if (full()) return false;
+    x.push_back(px);
+    y.push_back(py);
+    prevX.push_back(px);
+    prevY.push_back(py);
+    vx.push_back(0.0f);
+    vy.push_back(0.0f);
+    speed.push_back(enemySpeed);
+    health.push_back(enemyHealth);
+    return true;
+}
+
+void EnemyStore::removeAt(std::size_t i) {
+    std::size_t last = size() - 1;
+    if (i != last) {
+        x[i] = x[last];
+        y[i] = y[last];
+        prevX[i] = prevX[last];
+        prevY[i] = prevY[last];
+        vx[i] = vx[last];
+        vy[i] = vy[last];
+        speed[i] = speed[last];
+        health[i] = health[last];
+    }
+    x.pop_back();
+    y.pop_back();
+    prevX.pop_back();
+    prevY.pop_back();
+    vx.pop_back();
+    vy.pop_back();
+    speed.pop_back();
+    health.pop_back();
+}
+
+void EnemyStore::steer(float targetX, float targetY, std::size_t begin, std::size_t end) {
+    steerTowards(x.data() + begin, y.data() + begin, speed.data() + begin, vx.data() + begin, vy.data() + begin,
+                 end - begin, targetX, targetY);
+}
+
+void EnemyStore::integrate(float dt, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        prevX[i] = x[i];
+        prevY[i] = y[i];
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+    }
+}
+
+void EnemyStore::removeDead() {
+    for (std::size_t i = 0; i < size(); ) {
+        if (health[i] <= 0) removeAt(i);
+        else ++i;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+#include <vector>
+
+// Enemies as parallel arrays so the per-tick steering, movement and collision
+// loops stream through plain floats. Nothing here knows about sprites; the
+// renderer builds those from positions at draw time. Like FixedPool, the
+// arrays are allocated once for a fixed capacity and removal swaps the last
+// enemy into the hole, so order is not preserved.
+struct EnemyStore {
+    std::size_t capacity = 0;
+    std::vector<float> x, y;
+    std::vector<float> prevX, prevY;
+    std::vector<float> vx, vy;
+    std::vector<float> speed;
+    std::vector<int> health;
+
+    std::size_t size() const { return x.size(); }
+    bool empty() const { return x.empty(); }
+
+    bool full() const { return x.size() >= capacity; }
+
+    void allocate(std::size_t maxEnemies);
+    void clear();
+    // Returns false without spawning if the store is at capacity.
+    bool spawn(float px, float py, float enemySpeed, int enemyHealth);
+    void removeAt(std::size_t i);
+
+    // Points every enemy at the target at its own speed.
+    void steer(float targetX, float targetY) { steer(targetX, targetY, 0, size()); }
+    void integrate(float dt) { integrate(dt, 0, size()); }
+    // The same for enemies [begin, end) only; disjoint ranges can run on
+    // different threads.
+    void steer(float targetX, float targetY, std::size_t begin, std::size_t end);
+    void integrate(float dt, std::size_t begin, std::size_t end);
+    // Drops every enemy with no health left.
+    void removeDead();
+
+    sf::Vector2f getPosition(std::size_t i) const { return sf::Vector2f(x[i], y[i]); }
+    sf::Vector2f getInterpolatedPosition(std::size_t i, float alpha) const {
+        return sf::Vector2f(prevX[i] + (x[i] - prevX[i]) * alpha, prevY[i] + (y[i] - prevY[i]) * alpha);
+    }
+};
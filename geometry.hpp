@@ -0,0 +1,19 @@
+#pragma once
+
+// Overlap tests for the simulation's inner loops. All of them compare squared
+// distances, so none needs a sqrt.
+
+inline float distanceSquared(float ax, float ay, float bx, float by) {
+    float dx = ax - bx;
+    float dy = ay - by;
+    return dx * dx + dy * dy;
+}
+
+inline bool pointInCircle(float px, float py, float cx, float cy, float radius) {
+    return distanceSquared(px, py, cx, cy) < radius * radius;
+}
+
+inline bool circlesOverlap(float ax, float ay, float aRadius, float bx, float by, float bRadius) {
+    float reach = aRadius + bRadius;
+    return distanceSquared(ax, ay, bx, by) < reach * reach;
+}
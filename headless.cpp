@@ -0,0 +1,101 @@
+#include "headless.hpp"
+#include "geometry.hpp"
+#include "input_log.hpp"
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+// Aims at the nearest enemy, fires whenever it can and walks back towards the
+// zone centre once it drifts halfway to the edge.
+PlayerInput autopilot(const World& world) {
+    PlayerInput input;
+    sf::Vector2f playerPos = world.getPlayer().getPosition();
+
+    const EnemyStore& enemies = world.getEnemies();
+    float bestDist = -1.0f;
+    for (std::size_t i = 0; i < enemies.size(); ++i) {
+        float dist = distanceSquared(enemies.x[i], enemies.y[i], playerPos.x, playerPos.y);
+        if (bestDist < 0 || dist < bestDist) {
+            bestDist = dist;
+            input.aim = enemies.getPosition(i);
+        }
+    }
+    input.fire = bestDist >= 0;
+
+    const SafeZone& zone = world.getSafeZone();
+    sf::Vector2f toCenter = zone.getCenter() - playerPos;
+    if (!pointInCircle(playerPos.x, playerPos.y, zone.getCenter().x, zone.getCenter().y, zone.getRadius() * 0.5f)) {
+        float deadZone = PLAYER_SPEED * SIM_STEP;
+        input.left = toCenter.x < -deadZone;
+        input.right = toCenter.x > deadZone;
+        input.up = toCenter.y < -deadZone;
+        input.down = toCenter.y > deadZone;
+    }
+    return input;
+}
+
+}
+
+int runHeadless(const HeadlessOptions& options) {
+    // Keeps every tick so the CSV covers the whole run
+    Profiler profiler(SIMULATION_PHASES, 0);
+    Profiler* activeProfiler = options.profilePath.empty() ? nullptr : &profiler;
+    long long ticks = 0, matches = 0, totalScore = 0;
+
+    // A replay runs the whole recording from its own seed; the tick budget
+    // and match timeout only apply to the autopilot
+    InputReplay replay;
+    bool replaying = !options.replayPath.empty();
+    if (replaying && !replay.open(options.replayPath)) {
+        std::cerr << "Could not read replay " << options.replayPath << "\n";
+        return 1;
+    }
+    std::uint64_t seed = replaying ? replay.getSeed() : options.world.seed;
+    long long tickLimit = replaying ? static_cast<long long>(replay.getTickCount()) : options.ticks;
+    auto start = std::chrono::steady_clock::now();
+
+    // One World serves every match; reset() reuses its storage. Match i is
+    // seeded with seed + i so any single match can be reproduced on its own.
+    ThreadPool pool(options.threads);
+    World world(options.world);
+    world.setProfiler(activeProfiler);
+    world.setThreadPool(&pool);
+    for (std::uint64_t matchIndex = 0; ticks < tickLimit && (options.matches == 0 || matches < options.matches); ++matchIndex) {
+        world.reset(seed + matchIndex);
+        long long matchTicks = 0;
+        while (!world.isOver() && (replaying || matchTicks < options.matchTicks) && ticks < tickLimit) {
+            PlayerInput input;
+            if (replaying) replay.next(input);
+            else input = autopilot(world);
+            world.setInput(input);
+            world.step(SIM_STEP);
+            if (activeProfiler) activeProfiler->endFrame();
+            ++matchTicks;
+            ++ticks;
+        }
+        if (world.isOver() || (!replaying && matchTicks == options.matchTicks)) {
+            ++matches;
+            totalScore += world.getScore();
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "seed: " << seed << "\n"
+              << "threads: " << pool.getThreadCount() << "\n"
+              << "ticks: " << ticks << "\n"
+              << "matches: " << matches << "\n"
+              << "seconds: " << seconds << "\n"
+              << "ticks/s: " << (seconds > 0 ? ticks / seconds : 0.0) << "\n"
+              << "matches/min: " << (seconds > 0 ? matches * 60.0 / seconds : 0.0) << "\n"
+              << "avg score: " << (matches > 0 ? double(totalScore) / matches : 0.0) << "\n";
+
+    if (activeProfiler) {
+        std::cout << activeProfiler->formatReport();
+        if (!activeProfiler->writeCsv(options.profilePath)) {
+            std::cerr << "Could not write " << options.profilePath << "\n";
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <string>
+#include "world.hpp"
+
+struct HeadlessOptions {
+    long long ticks = 100000;
+    long long matches = 0;          // 0 = no limit, stop on the tick budget only
+    long long matchTicks = 18000;   // a match the autopilot survives this long ends as a timeout
+    WorldConfig world;
+    std::string profilePath;        // if set, per-tick phase timings are written here as CSV
+    std::string replayPath;         // if set, the recorded session is replayed instead of the autopilot
+    unsigned threads = 0;           // simulation threads including the main one; 0 = one per core
+};
+
+// Runs back-to-back matches with no window, textures or audio, driving the
+// player with a simple autopilot or a recorded session, and prints
+// simulation throughput.
+int runHeadless(const HeadlessOptions& options);
@@ -0,0 +1,20 @@
+#include "hud.hpp"
+
+Hud::Hud(const sf::Font& font)
+    : text("", font, 20), score(0), kills(0), health(0), dirty(true) {
+    text.setFillColor(sf::Color::White);
+    text.setPosition(10, 10);
+    buffer[0] = '\0';
+}
+
+bool Hud::update(int newScore, int newKills, int newHealth) {
+    if (!dirty && newScore == score && newKills == kills && newHealth == health) return false;
+
+    score = newScore;
+    kills = newKills;
+    health = newHealth;
+    dirty = false;
+    formatHudLine(buffer, score, kills, health);
+    text.setString(buffer);
+    return true;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "text_format.hpp"
+
+const int HUD_BUFFER_SIZE = 128;
+
+// Builds the HUD line into out, which must hold HUD_BUFFER_SIZE chars.
+inline char* formatHudLine(char* out, int score, int kills, int health) {
+    out = appendText(out, "The Last Helldiver | Score: ");
+    out = appendInt(out, score);
+    out = appendText(out, " | Kills: ");
+    out = appendInt(out, kills);
+    out = appendText(out, " | Health: ");
+    return appendInt(out, health);
+}
+
+// The in-game status line. It remembers the values it last showed and only
+// reformats (and makes sf::Text rebuild its glyphs) when one of them changes.
+class Hud {
+private:
+    sf::Text text;
+    char buffer[HUD_BUFFER_SIZE];
+    int score;
+    int kills;
+    int health;
+    bool dirty;
+
+public:
+    explicit Hud(const sf::Font& font);
+
+    // Returns true if the text had to be rebuilt.
+    bool update(int newScore, int newKills, int newHealth);
+    const sf::Text& getText() const { return text; }
+};
@@ -0,0 +1,72 @@
+#include "input_log.hpp"
+#include <cstring>
+
+InputRecord packInput(const PlayerInput& input) {
+    InputRecord record;
+    std::memset(&record, 0, sizeof(record));
+    if (input.up) record.buttons |= INPUT_UP;
+    if (input.down) record.buttons |= INPUT_DOWN;
+    if (input.left) record.buttons |= INPUT_LEFT;
+    if (input.right) record.buttons |= INPUT_RIGHT;
+    if (input.fire) record.buttons |= INPUT_FIRE;
+    record.aimX = input.aim.x;
+    record.aimY = input.aim.y;
+    return record;
+}
+
+PlayerInput unpackInput(const InputRecord& record) {
+    PlayerInput input;
+    input.up = (record.buttons & INPUT_UP) != 0;
+    input.down = (record.buttons & INPUT_DOWN) != 0;
+    input.left = (record.buttons & INPUT_LEFT) != 0;
+    input.right = (record.buttons & INPUT_RIGHT) != 0;
+    input.fire = (record.buttons & INPUT_FIRE) != 0;
+    input.aim = sf::Vector2f(record.aimX, record.aimY);
+    return input;
+}
+
+bool InputRecorder::open(const std::string& path, std::uint64_t seed) {
+    out.open(path, std::ios::binary | std::ios::trunc);
+    if (!out) return false;
+    InputLogHeader header;
+    std::memcpy(header.magic, INPUT_LOG_MAGIC, sizeof(header.magic));
+    header.version = INPUT_LOG_VERSION;
+    header.seed = seed;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return static_cast<bool>(out);
+}
+
+void InputRecorder::record(const PlayerInput& input) {
+    if (!out.is_open()) return;
+    InputRecord record = packInput(input);
+    out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+}
+
+void InputRecorder::close() {
+    if (out.is_open()) out.close();
+}
+
+InputReplay::InputReplay() : records(nullptr), count(0), position(0), seed(0) {}
+
+bool InputReplay::open(const std::string& path) {
+    records = nullptr;
+    count = position = 0;
+    if (!file.open(path) || file.size() < sizeof(InputLogHeader)) return false;
+
+    InputLogHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, INPUT_LOG_MAGIC, sizeof(header.magic)) != 0 || header.version != INPUT_LOG_VERSION)
+        return false;
+
+    seed = header.seed;
+    records = reinterpret_cast<const InputRecord*>(file.data() + sizeof(header));
+    // A session cut short by a crash may end in a partial record; drop it
+    count = (file.size() - sizeof(header)) / sizeof(InputRecord);
+    return true;
+}
+
+bool InputReplay::next(PlayerInput& input) {
+    if (position >= count) return false;
+    input = unpackInput(records[position++]);
+    return true;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "mapped_file.hpp"
+#include "world.hpp"
+
+// Recorded session: the seed of the first match and the input the World saw
+// on every tick. Since a match is fully determined by its seed and inputs,
+// replaying the ticks reproduces the session exactly; a new match (seed + 1)
+// starts on the tick after the previous one ended.
+//
+// Layout (little-endian):
+//   InputLogHeader
+//   InputRecord[ticks]
+
+const char INPUT_LOG_MAGIC[4] = {'H', 'D', 'I', 'R'};
+const std::uint32_t INPUT_LOG_VERSION = 1;
+
+struct InputLogHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint64_t seed;
+};
+
+enum InputButton : std::uint8_t {
+    INPUT_UP = 1 << 0,
+    INPUT_DOWN = 1 << 1,
+    INPUT_LEFT = 1 << 2,
+    INPUT_RIGHT = 1 << 3,
+    INPUT_FIRE = 1 << 4
+};
+
+struct InputRecord {
+    std::uint8_t buttons;
+    std::uint8_t reserved[3];
+    float aimX;
+    float aimY;
+};
+
+static_assert(sizeof(InputLogHeader) == 16, "InputLogHeader must match the on-disk layout");
+static_assert(sizeof(InputRecord) == 12, "InputRecord must match the on-disk layout");
+
+InputRecord packInput(const PlayerInput& input);
+PlayerInput unpackInput(const InputRecord& record);
+
+// Appends one record per tick through a buffered stream.
+class InputRecorder {
+private:
+    std::ofstream out;
+
+public:
+    bool open(const std::string& path, std::uint64_t seed);
+    bool isOpen() const { return out.is_open(); }
+    // Call with world.getInput() right before each world.step().
+    void record(const PlayerInput& input);
+    void close();
+};
+
+// Plays a recording back from a read-only mapping.
+class InputReplay {
+private:
+    MappedFile file;
+    const InputRecord* records;
+    std::size_t count;
+    std::size_t position;
+    std::uint64_t seed;
+
+public:
+    InputReplay();
+
+    bool open(const std::string& path);
+    std::uint64_t getSeed() const { return seed; }
+    std::size_t getTickCount() const { return count; }
+    bool finished() const { return position >= count; }
+    // Input for the next tick; false once the recording is exhausted.
+    bool next(PlayerInput& input);
+};
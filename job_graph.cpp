@@ -0,0 +1,45 @@
+#include "job_graph.hpp"
+
+JobGraph::JobId JobGraph::add(std::function<void()> job, std::initializer_list<JobId> dependencies) {
+    JobId id = nodes.size();
+    nodes.emplace_back(new Node());
+    nodes[id]->job = std::move(job);
+    for (JobId dependency : dependencies) {
+        nodes[dependency]->dependents.push_back(id);
+        ++nodes[id]->dependencyCount;
+    }
+    return id;
+}
+
+void JobGraph::schedule(JobId id) {
+    Task task = {&JobGraph::runNode, this, id, id + 1, activeGroup};
+    activePool->submit(task);
+}
+
+void JobGraph::runNode(void* context, std::size_t id, std::size_t) {
+    JobGraph& graph = *static_cast<JobGraph*>(context);
+    graph.nodes[id]->job();
+    // The last dependency to finish releases the dependent; acq_rel makes
+    // every finished dependency's writes visible to it
+    for (JobId dependent : graph.nodes[id]->dependents) {
+        if (graph.nodes[dependent]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) graph.schedule(dependent);
+    }
+}
+
+void JobGraph::run(ThreadPool* pool) {
+    if (!pool || pool->getThreadCount() == 1) {
+        for (const std::unique_ptr<Node>& node : nodes) node->job();
+        return;
+    }
+
+    for (const std::unique_ptr<Node>& node : nodes) node->remaining.store(node->dependencyCount, std::memory_order_relaxed);
+    TaskGroup group;
+    activePool = pool;
+    activeGroup = &group;
+    for (JobId id = 0; id < nodes.size(); ++id) {
+        if (nodes[id]->dependencyCount == 0) schedule(id);
+    }
+    pool->wait(group);
+    activePool = nullptr;
+    activeGroup = nullptr;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+#include "thread_pool.hpp"
+
+// A fixed set of jobs with dependencies, declared once and run as often as
+// needed (once per frame or tick). A job starts as soon as everything it
+// depends on has finished, so independent jobs overlap on the pool.
+class JobGraph {
+public:
+    typedef std::size_t JobId;
+
+private:
+    struct Node {
+        std::function<void()> job;
+        std::vector<JobId> dependents;
+        unsigned dependencyCount = 0;
+        std::atomic<unsigned> remaining{0};
+    };
+
+    std::vector<std::unique_ptr<Node>> nodes;
+    ThreadPool* activePool;
+    TaskGroup* activeGroup;
+
+    void schedule(JobId id);
+    static void runNode(void* context, std::size_t id, std::size_t);
+
+public:
+    JobGraph() : activePool(nullptr), activeGroup(nullptr) {}
+    JobGraph(const JobGraph&) = delete;
+    JobGraph& operator=(const JobGraph&) = delete;
+
+    // Dependencies must already be in the graph, which keeps it acyclic and
+    // makes the order of adding a valid serial order.
+    JobId add(std::function<void()> job, std::initializer_list<JobId> dependencies = {});
+
+    // Runs every job once and returns when all are done. Without a pool (or
+    // with a single-thread one) the jobs run here in the order they were added.
+    void run(ThreadPool* pool);
+};
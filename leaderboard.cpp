@@ -0,0 +1,146 @@
+#include "leaderboard.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+struct Leaderboard::Header {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t topCapacity;
+    std::uint32_t scoreBuckets;
+    std::uint32_t killBuckets;
+    std::uint32_t topCount;
+    std::uint64_t count;
+};
+
+namespace {
+
+const std::uint32_t LEADERBOARD_MAGIC = 0x424C4448;   // "HDLB"
+const std::uint32_t LEADERBOARD_VERSION = 1;
+
+// Fenwick tree over bucket counts, stored 1-based in the mapped file: slot
+// i - 1 holds the sum of the (i & -i) buckets ending at bucket i - 1.
+void fenwickAdd(std::uint32_t* tree, unsigned size, unsigned bucket) {
+    for (unsigned i = bucket + 1; i <= size; i += i & (0u - i)) ++tree[i - 1];
+}
+
+// Number of entries in buckets [0, bucketCount).
+std::uint64_t fenwickPrefix(const std::uint32_t* tree, unsigned bucketCount) {
+    std::uint64_t sum = 0;
+    for (unsigned i = bucketCount; i > 0; i -= i & (0u - i)) sum += tree[i - 1];
+    return sum;
+}
+
+// Smallest bucket whose inclusive prefix reaches target (target >= 1).
+unsigned fenwickFind(const std::uint32_t* tree, unsigned size, std::uint64_t target) {
+    unsigned position = 0;
+    unsigned step = 1;
+    while (step * 2 <= size) step *= 2;
+    for (; step > 0; step /= 2) {
+        if (position + step <= size && tree[position + step - 1] < target) {
+            position += step;
+            target -= tree[position - 1];
+        }
+    }
+    return std::min(position, size - 1);
+}
+
+unsigned clampBucket(long long value, unsigned buckets) {
+    if (value < 0) return 0;
+    return static_cast<unsigned>(std::min<long long>(value, buckets - 1));
+}
+
+unsigned scoreBucket(int score) { return clampBucket(score / Leaderboard::SCORE_BUCKET_WIDTH, Leaderboard::SCORE_BUCKETS); }
+unsigned killBucket(int kills) { return clampBucket(kills, Leaderboard::KILL_BUCKETS); }
+
+// Best first: higher score, then more kills, then the earlier match.
+bool ranksBefore(const LeaderboardEntry& a, const LeaderboardEntry& b) {
+    if (a.score != b.score) return a.score > b.score;
+    if (a.kills != b.kills) return a.kills > b.kills;
+    return a.timestamp < b.timestamp;
+}
+
+const std::size_t TOP_OFFSET = 32;
+const std::size_t SCORE_TREE_OFFSET = TOP_OFFSET + Leaderboard::TOP_CAPACITY * sizeof(LeaderboardEntry);
+const std::size_t KILL_TREE_OFFSET = SCORE_TREE_OFFSET + Leaderboard::SCORE_BUCKETS * sizeof(std::uint32_t);
+const std::size_t FILE_SIZE = KILL_TREE_OFFSET + Leaderboard::KILL_BUCKETS * sizeof(std::uint32_t);
+
+}
+
+Leaderboard::Leaderboard()
+    : header(nullptr), top(nullptr), scoreTree(nullptr), killTree(nullptr), created(false) {}
+
+bool Leaderboard::open(const std::string& path) {
+    static_assert(sizeof(Header) == TOP_OFFSET, "Header must match the on-disk layout");
+
+    header = nullptr;
+    if (!file.openWritable(path, FILE_SIZE)) return false;
+
+    unsigned char* bytes = file.mutableData();
+    header = reinterpret_cast<Header*>(bytes);
+    top = reinterpret_cast<LeaderboardEntry*>(bytes + TOP_OFFSET);
+    scoreTree = reinterpret_cast<std::uint32_t*>(bytes + SCORE_TREE_OFFSET);
+    killTree = reinterpret_cast<std::uint32_t*>(bytes + KILL_TREE_OFFSET);
+
+    // The mapping never shrinks the file, so trailing bytes past the layout
+    // are ignored rather than taken as a sign of a foreign file
+    created = file.size() < FILE_SIZE || header->magic != LEADERBOARD_MAGIC ||
+              header->version != LEADERBOARD_VERSION || header->topCapacity != TOP_CAPACITY ||
+              header->scoreBuckets != SCORE_BUCKETS || header->killBuckets != KILL_BUCKETS ||
+              header->topCount > TOP_CAPACITY;
+    if (created) clear();
+    return true;
+}
+
+void Leaderboard::clear() {
+    if (!header) return;
+    std::memset(file.mutableData(), 0, FILE_SIZE);
+    header->magic = LEADERBOARD_MAGIC;
+    header->version = LEADERBOARD_VERSION;
+    header->topCapacity = TOP_CAPACITY;
+    header->scoreBuckets = SCORE_BUCKETS;
+    header->killBuckets = KILL_BUCKETS;
+}
+
+void Leaderboard::insert(int score, int kills, std::int64_t timestamp) {
+    if (!header) return;
+    fenwickAdd(scoreTree, SCORE_BUCKETS, scoreBucket(score));
+    fenwickAdd(killTree, KILL_BUCKETS, killBucket(kills));
+    ++header->count;
+
+    LeaderboardEntry entry;
+    entry.score = score;
+    entry.kills = kills;
+    entry.timestamp = timestamp;
+    LeaderboardEntry* end = top + header->topCount;
+    LeaderboardEntry* slot = std::upper_bound(top, end, entry, ranksBefore);
+    if (slot == top + TOP_CAPACITY) return;
+
+    // Shift the lower ranks down one, dropping the last if the table is full
+    if (header->topCount < TOP_CAPACITY) ++header->topCount;
+    std::memmove(slot + 1, slot, (top + header->topCount - 1 - slot) * sizeof(LeaderboardEntry));
+    *slot = entry;
+}
+
+std::uint64_t Leaderboard::getCount() const { return header ? header->count : 0; }
+
+std::size_t Leaderboard::getTopCount() const { return header ? header->topCount : 0; }
+
+const LeaderboardEntry& Leaderboard::getTop(std::size_t rank) const { return top[rank]; }
+
+double Leaderboard::getScorePercentile(int score) const {
+    if (getCount() == 0) return 0.0;
+    return static_cast<double>(fenwickPrefix(scoreTree, scoreBucket(score))) / header->count;
+}
+
+int Leaderboard::getScoreAtPercentile(double fraction) const {
+    if (getCount() == 0) return 0;
+    double clamped = std::min(std::max(fraction, 0.0), 1.0);
+    std::uint64_t target = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(clamped * header->count)));
+    return static_cast<int>(fenwickFind(scoreTree, SCORE_BUCKETS, target)) * SCORE_BUCKET_WIDTH;
+}
+
+double Leaderboard::getKillPercentile(int kills) const {
+    if (getCount() == 0) return 0.0;
+    return static_cast<double>(fenwickPrefix(killTree, killBucket(kills))) / header->count;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "mapped_file.hpp"
+
+struct LeaderboardEntry {
+    std::int32_t score;
+    std::int32_t kills;
+    std::int64_t timestamp;   // seconds since the epoch
+};
+
+static_assert(sizeof(LeaderboardEntry) == 16, "LeaderboardEntry must match the on-disk layout");
+
+// Persistent leaderboard kept in one fixed-size, memory-mapped file: a header,
+// the best TOP_CAPACITY matches in rank order, and Fenwick trees counting
+// every recorded match per score bucket and per kill count. Inserting and
+// percentile queries are O(log buckets) and touch a handful of pages no
+// matter how many matches have been recorded; reading the top N is a copy.
+class Leaderboard {
+public:
+    static const unsigned TOP_CAPACITY = 100;
+    static const int SCORE_BUCKET_WIDTH = 10;   // scores move in steps of 10
+    static const unsigned SCORE_BUCKETS = 65536;
+    static const unsigned KILL_BUCKETS = 65536;
+
+private:
+    struct Header;
+
+    MappedFile file;
+    Header* header;
+    LeaderboardEntry* top;
+    std::uint32_t* scoreTree;
+    std::uint32_t* killTree;
+    bool created;
+
+public:
+    Leaderboard();
+    Leaderboard(const Leaderboard&) = delete;
+    Leaderboard& operator=(const Leaderboard&) = delete;
+
+    // Maps the file, creating it (or starting over if it is not a valid
+    // leaderboard of this layout) when needed.
+    bool open(const std::string& path);
+    bool isOpen() const { return header != nullptr; }
+    // True if open() had to start from an empty leaderboard.
+    bool wasCreated() const { return created; }
+    // Forgets every recorded match, e.g. before rebuilding from the log.
+    void clear();
+
+    void insert(int score, int kills, std::int64_t timestamp);
+
+    std::uint64_t getCount() const;
+    std::size_t getTopCount() const;
+    // Rank 0 is the best match.
+    const LeaderboardEntry& getTop(std::size_t rank) const;
+
+    // Fraction of recorded matches that scored strictly less.
+    double getScorePercentile(int score) const;
+    // Lowest score reached by the given fraction of matches (0.5 = median).
+    int getScoreAtPercentile(double fraction) const;
+    // Fraction of recorded matches with strictly fewer kills.
+    double getKillPercentile(int kills) const;
+};
@@ -1,301 +1,501 @@
-#include <SFML/Graphics.hpp>
-#include <SFML/Audio.hpp>
-#include <vector>
-#include <cmath>
-#include <ctime>
-#include <fstream>
-#include <iostream>
-
-const int WINDOW_WIDTH = 1200;
-const int WINDOW_HEIGHT = 700;
-const float PLAYER_SPEED = 3.0f;
-const float ENEMY_SPEED = 1.0f;
-const float BULLET_SPEED = 7.0f;
-const float SAFE_ZONE_SHRINK_RATE = 0.1f;
-const float BULLET_COOLDOWN = 0.3f;
-
-class Entity {
-protected:
-    sf::Sprite sprite;
-    sf::Vector2f velocity;
-    float speed;
-    int health;
-
-public:
-    Entity(float x, float y, const sf::Texture& texture, float speed, int health)
-        : speed(speed), health(health) {
-        sprite.setTexture(texture);
-        sprite.setPosition(x, y);
-        sprite.setOrigin(texture.getSize().x / 2, texture.getSize().y / 2);
-    }
-
-    void move() { sprite.move(velocity); }
-    bool isAlive() const { return health > 0; }
-    void takeDamage(int amount) { health -= amount; }
-    sf::Vector2f getPosition() const { return sprite.getPosition(); }
-    sf::Sprite& getSprite() { return sprite; }
-    int getHealth() const { return health; }
-};
-
-class Player : public Entity {
-public:
-    Player(const sf::Texture& texture) : Entity(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2, texture, PLAYER_SPEED, 100) {}
-
-    void handleInput() {
-        velocity = {0, 0};
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::W)) velocity.y -= speed;
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::S)) velocity.y += speed;
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::A)) velocity.x -= speed;
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::D)) velocity.x += speed;
-    }
-};
-
-class Enemy : public Entity {
-public:
-    Enemy(float x, float y, const sf::Texture& texture)
-        : Entity(x, y, texture, ENEMY_SPEED + static_cast<float>(rand() % 20) / 10.0f, 50) {}
-
-    void update(const sf::Vector2f& playerPos) {
-        sf::Vector2f direction = playerPos - sprite.getPosition();
-        float length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
-        if (length > 0) {
-            direction /= length;
-            velocity = direction * speed;
-        }
-    }
-};
-
-class Bullet {
-private:
-    sf::CircleShape shape;
-    sf::Vector2f velocity;
-    float speed;
-
-public:
-    Bullet(float x, float y, float dirX, float dirY)
-        : shape(5), speed(BULLET_SPEED) {
-        shape.setFillColor(sf::Color::Yellow);
-        shape.setPosition(x, y);
-        float length = std::sqrt(dirX * dirX + dirY * dirY);
-        if (length > 0) {
-            velocity.x = (dirX / length) * speed;
-            velocity.y = (dirY / length) * speed;
-        }
-    }
-
-    void move() { shape.move(velocity); }
-    sf::Vector2f getPosition() const { return shape.getPosition(); }
-    float getRadius() const { return shape.getRadius(); }
-    sf::CircleShape& getShape() { return shape; }
-};
-
-class SafeZone {
-private:
-    sf::Sprite sprite;
-    float shrinkRate;
-    float minRadius;
-    float radius;
-
-public:
-    SafeZone(const sf::Texture& texture)
-        : shrinkRate(SAFE_ZONE_SHRINK_RATE), minRadius(50.0f) {
-        sprite.setTexture(texture);
-        radius = std::min(WINDOW_WIDTH, WINDOW_HEIGHT) * 0.5f;
-        sprite.setOrigin(texture.getSize().x / 2, texture.getSize().y / 2);
-        sprite.setPosition(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
-        float scaleFactor = radius / (texture.getSize().x / 2);
-        sprite.setScale(scaleFactor, scaleFactor);
-    }
-
-    void update() {
-        if (radius > minRadius) {
-            radius -= shrinkRate;
-            float scaleFactor = radius / (sprite.getTexture()->getSize().x / 2);
-            sprite.setScale(scaleFactor, scaleFactor);
-        }
-    }
-
-    bool isInside(const sf::Vector2f& position) const {
-        sf::Vector2f center(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
-        float distance = std::sqrt(std::pow(position.x - center.x, 2) + std::pow(position.y - center.y, 2));
-        return distance < radius;
-    }
-
-    sf::Sprite& getSprite() { return sprite; }
-};
-
-void showStartScreen(sf::RenderWindow& window, sf::Font& font) {
-    sf::Text title("THE LAST HELLDIVER", font, 48);
-    title.setFillColor(sf::Color::Red);
-    title.setStyle(sf::Text::Bold);
-    title.setPosition(WINDOW_WIDTH / 2 - title.getLocalBounds().width / 2, 100);
-
-    sf::Text lore("In a world consumed by chaos, only one survives.\nYou are the last Helldiver - forged in fire, bound by honor.\nSurvive the void. Protect the zone. Write your legend.", font, 18);
-    lore.setFillColor(sf::Color(180, 180, 180));
-    lore.setPosition(WINDOW_WIDTH / 2 - lore.getLocalBounds().width / 2, 200);
-
-    sf::Text prompt("Press ENTER to Begin Your Dive", font, 24);
-    prompt.setFillColor(sf::Color::White);
-    prompt.setPosition(WINDOW_WIDTH / 2 - prompt.getLocalBounds().width / 2, 350);
-
-    window.clear(sf::Color::Black);
-    window.draw(title);
-    window.draw(lore);
-    window.draw(prompt);
-    window.display();
-
-    while (true) {
-        sf::Event event;
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed)
-                window.close();
-        }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Enter)) break;
-    }
-}
-
-int main() {
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
-    sf::RenderWindow window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "The Last Helldiver");
-    window.setFramerateLimit(60);
-
-    // Background
-    sf::Texture backgroundTexture;
-    backgroundTexture.loadFromFile("background.jpeg");
-    sf::Sprite background(backgroundTexture);
-    background.setScale(
-        float(WINDOW_WIDTH) / backgroundTexture.getSize().x,
-        float(WINDOW_HEIGHT) / backgroundTexture.getSize().y);
-
-    // Load textures
-    sf::Texture playerTexture, enemyTexture, zoneTexture, gameOverTexture;
-    playerTexture.loadFromFile("player.png");
-    enemyTexture.loadFromFile("enemy.png");
-    zoneTexture.loadFromFile("zone_fire.png");
-    gameOverTexture.loadFromFile("gameover.jpg");
-    sf::Sprite gameOverBg(gameOverTexture);
-    gameOverBg.setScale(
-        float(WINDOW_WIDTH) / gameOverTexture.getSize().x,
-        float(WINDOW_HEIGHT) / gameOverTexture.getSize().y);
-
-    // Font & HUD
-    sf::Font font;
-    font.loadFromFile("arial.ttf");
-    showStartScreen(window, font);
-
-    Player player(playerTexture);
-    std::vector<Enemy> enemies;
-    std::vector<Bullet> bullets;
-    SafeZone safeZone(zoneTexture);
-
-    for (int i = 0; i < 5; ++i) {
-        enemies.emplace_back(rand() % WINDOW_WIDTH, rand() % WINDOW_HEIGHT, enemyTexture);
-    }
-
-    sf::Text hudText("", font, 20);
-    hudText.setFillColor(sf::Color::White);
-    hudText.setPosition(10, 10);
-
-    sf::SoundBuffer shootBuffer;
-    shootBuffer.loadFromFile("shoot.wav");
-    sf::Sound shootSound(shootBuffer);
-
-    sf::Clock clock, bulletClock;
-    float timeSinceLastSpawn = 0.0f;
-    int score = 0, killCount = 0;
-
-    while (window.isOpen()) {
-        sf::Event event;
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed)
-                window.close();
-            if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left && bulletClock.getElapsedTime().asSeconds() > BULLET_COOLDOWN) {
-                sf::Vector2f playerPos = player.getPosition();
-                sf::Vector2i mousePos = sf::Mouse::getPosition(window);
-                bullets.emplace_back(playerPos.x, playerPos.y, mousePos.x - playerPos.x, mousePos.y - playerPos.y);
-                shootSound.play();
-                bulletClock.restart();
-            }
-        }
-
-        float deltaTime = clock.restart().asSeconds();
-        timeSinceLastSpawn += deltaTime;
-        player.handleInput();
-        player.move();
-
-        for (auto it = bullets.begin(); it != bullets.end(); ) {
-            it->move();
-            if (it->getPosition().x < 0 || it->getPosition().x > WINDOW_WIDTH || it->getPosition().y < 0 || it->getPosition().y > WINDOW_HEIGHT) {
-                it = bullets.erase(it);
-            } else ++it;
-        }
-
-        for (auto enemyIt = enemies.begin(); enemyIt != enemies.end(); ) {
-            enemyIt->update(player.getPosition());
-            enemyIt->move();
-
-            bool dead = false;
-            for (auto bulletIt = bullets.begin(); bulletIt != bullets.end(); ) {
-                float dx = bulletIt->getPosition().x - enemyIt->getPosition().x;
-                float dy = bulletIt->getPosition().y - enemyIt->getPosition().y;
-                float dist = std::sqrt(dx * dx + dy * dy);
-
-                if (dist < bulletIt->getRadius() + 12) {
-                    enemyIt->takeDamage(25);
-                    bulletIt = bullets.erase(bulletIt);
-                    if (!enemyIt->isAlive()) {
-                        score += 10;
-                        killCount++;
-                        dead = true;
-                    }
-                    break;
-                } else ++bulletIt;
-            }
-
-            if (dead) enemyIt = enemies.erase(enemyIt);
-            else {
-                float dx = player.getPosition().x - enemyIt->getPosition().x;
-                float dy = player.getPosition().y - enemyIt->getPosition().y;
-                if (std::sqrt(dx * dx + dy * dy) < 20) player.takeDamage(1);
-                ++enemyIt;
-            }
-        }
-
-        safeZone.update();
-        bool out = !safeZone.isInside(player.getPosition());
-        if (out) player.takeDamage(1);
-
-        if (timeSinceLastSpawn > 3.0f && enemies.size() < 10) {
-            enemies.emplace_back(rand() % WINDOW_WIDTH, rand() % WINDOW_HEIGHT, enemyTexture);
-            timeSinceLastSpawn = 0.0f;
-        }
-
-        hudText.setString("The Last Helldiver | Score: " + std::to_string(score) + " | Kills: " + std::to_string(killCount) + " | Health: " + std::to_string(player.getHealth()));
-
-        window.clear();
-        window.draw(background);
-        window.draw(safeZone.getSprite());
-        for (auto& b : bullets) window.draw(b.getShape());
-        for (auto& e : enemies) window.draw(e.getSprite());
-        window.draw(player.getSprite());
-        window.draw(hudText);
-        window.display();
-
-        if (!player.isAlive()) {
-            std::ofstream file("game_score.txt");
-            file << "Final Score: " << score << "\nKills: " << killCount;
-            file.close();
-
-            sf::Text gameOver("The Last Helldiver Fell\nFinal Score: " + std::to_string(score) + " | Kills: " + std::to_string(killCount), font, 32);
-            gameOver.setFillColor(sf::Color::Red);
-            gameOver.setPosition(WINDOW_WIDTH / 2 - gameOver.getLocalBounds().width / 2, WINDOW_HEIGHT / 2);
-            window.clear();
-            window.draw(gameOverBg);
-            window.draw(gameOver);
-            window.display();
-            sf::sleep(sf::seconds(3));
-            window.close();
-        }
-    }
-    return 0;
-}
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <ctime>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include "asset_loader.hpp"
+#include "asset_pack.hpp"
+#include "audio_mixer.hpp"
+#include "config.hpp"
+#include "headless.hpp"
+#include "hud.hpp"
+#include "input_log.hpp"
+#include "job_graph.hpp"
+#include "leaderboard.hpp"
+#include "profiler.hpp"
+#include "results_log.hpp"
+#include "sim_thread.hpp"
+#include "sprite_batch.hpp"
+#include "texture_atlas.hpp"
+#include "thread_pool.hpp"
+#include "world.hpp"
+
+enum class GameState { Menu, Playing, GameOver };
+
+class StartScreen {
+private:
+    sf::Text title;
+    sf::Text lore;
+    sf::Text prompt;
+    sf::Text scores;
+
+public:
+    explicit StartScreen(const sf::Font& font)
+        : title("THE LAST HELLDIVER", font, 48),
+          lore("In a world consumed by chaos, only one survives.\nYou are the last Helldiver - forged in fire, bound by honor.\nSurvive the void. Protect the zone. Write your legend.", font, 18),
+          prompt("", font, 24),
+          scores("", font, 18) {
+        title.setFillColor(sf::Color::Red);
+        title.setStyle(sf::Text::Bold);
+        title.setPosition(WINDOW_WIDTH / 2 - title.getLocalBounds().width / 2, 100);
+        lore.setFillColor(sf::Color(180, 180, 180));
+        lore.setPosition(WINDOW_WIDTH / 2 - lore.getLocalBounds().width / 2, 200);
+        prompt.setFillColor(sf::Color::White);
+        setPrompt("Press ENTER to Begin Your Dive");
+        scores.setFillColor(sf::Color(220, 200, 120));
+    }
+
+    void setPrompt(const sf::String& text) {
+        prompt.setString(text);
+        prompt.setPosition(WINDOW_WIDTH / 2 - prompt.getLocalBounds().width / 2, 350);
+    }
+
+    void setLeaderboard(const Leaderboard& leaderboard) {
+        std::string text;
+        if (leaderboard.getTopCount() > 0) {
+            text = "TOP DIVERS (" + std::to_string(leaderboard.getCount()) + " dives recorded)\n";
+            for (std::size_t i = 0; i < std::min<std::size_t>(leaderboard.getTopCount(), 5); ++i) {
+                const LeaderboardEntry& entry = leaderboard.getTop(i);
+                std::time_t when = static_cast<std::time_t>(entry.timestamp);
+                char date[16] = "";
+                if (const std::tm* local = std::localtime(&when)) std::strftime(date, sizeof(date), "%Y-%m-%d", local);
+                text += std::to_string(i + 1) + ".  " + std::to_string(entry.score) + " pts  " +
+                        std::to_string(entry.kills) + " kills  " + date + "\n";
+            }
+        }
+        scores.setString(text);
+        scores.setPosition(WINDOW_WIDTH / 2 - scores.getLocalBounds().width / 2, 430);
+    }
+
+    void draw(sf::RenderWindow& window) const {
+        window.clear(sf::Color::Black);
+        window.draw(title);
+        window.draw(lore);
+        window.draw(prompt);
+        window.draw(scores);
+        window.display();
+    }
+};
+
+// Bullets used to be CircleShapes; baking the circle into a small texture lets
+// them go through a SpriteBatch like every other sprite.
+sf::Image makeBulletImage() {
+    unsigned size = static_cast<unsigned>(BULLET_RADIUS * 2);
+    sf::Image image;
+    image.create(size, size, sf::Color::Transparent);
+    for (unsigned y = 0; y < size; ++y) {
+        for (unsigned x = 0; x < size; ++x) {
+            float dx = x + 0.5f - BULLET_RADIUS;
+            float dy = y + 0.5f - BULLET_RADIUS;
+            if (dx * dx + dy * dy <= BULLET_RADIUS * BULLET_RADIUS) image.setPixel(x, y, sf::Color::Yellow);
+        }
+    }
+    return image;
+}
+
+// Everything the frame loop draws or plays. Created on the render thread
+// from the decoded assets once the loader has finished.
+struct GameResources {
+    sf::Texture backgroundTexture;
+    sf::Texture gameOverTexture;
+    sf::Sprite background;
+    sf::Sprite gameOverBg;
+    TextureAtlas atlas;
+    sf::IntRect playerRect;
+    sf::IntRect enemyRect;
+    sf::IntRect zoneRect;
+    sf::IntRect bulletRect;
+    sf::SoundBuffer shootBuffer;
+
+    void upload(const DecodedAssets& decoded) {
+        backgroundTexture.loadFromImage(decoded.background);
+        background.setTexture(backgroundTexture, true);
+        background.setScale(
+            float(WINDOW_WIDTH) / backgroundTexture.getSize().x,
+            float(WINDOW_HEIGHT) / backgroundTexture.getSize().y);
+
+        gameOverTexture.loadFromImage(decoded.gameOver);
+        gameOverBg.setTexture(gameOverTexture, true);
+        gameOverBg.setScale(
+            float(WINDOW_WIDTH) / gameOverTexture.getSize().x,
+            float(WINDOW_HEIGHT) / gameOverTexture.getSize().y);
+
+        // Sprite art is packed into one atlas texture
+        atlas.add("player", decoded.player);
+        atlas.add("enemy", decoded.enemy);
+        atlas.add("zone", decoded.zone);
+        atlas.add("bullet", makeBulletImage());
+        atlas.build();
+        playerRect = atlas.getRegion("player");
+        enemyRect = atlas.getRegion("enemy");
+        zoneRect = atlas.getRegion("zone");
+        bulletRect = atlas.getRegion("bullet");
+
+        shootBuffer = decoded.shoot;
+    }
+};
+
+PlayerInput readPlayerInput(const sf::RenderWindow& window, bool fire) {
+    PlayerInput input;
+    input.up = sf::Keyboard::isKeyPressed(sf::Keyboard::W);
+    input.down = sf::Keyboard::isKeyPressed(sf::Keyboard::S);
+    input.left = sf::Keyboard::isKeyPressed(sf::Keyboard::A);
+    input.right = sf::Keyboard::isKeyPressed(sf::Keyboard::D);
+    input.fire = fire;
+    sf::Vector2i mousePos = sf::Mouse::getPosition(window);
+    input.aim = sf::Vector2f(mousePos.x, mousePos.y);
+    return input;
+}
+
+bool parseSyncPolicy(const char* name, SyncPolicy& policy) {
+    if (std::strcmp(name, "never") == 0) policy = SyncPolicy::Never;
+    else if (std::strcmp(name, "record") == 0) policy = SyncPolicy::EveryRecord;
+    else if (std::strcmp(name, "close") == 0) policy = SyncPolicy::OnClose;
+    else return false;
+    return true;
+}
+
+// Upper bounds for the numeric options
+const unsigned long long MAX_TICKS = 1000000000000ULL;
+const unsigned long long MAX_ENEMY_OPTION = 10000000;
+const unsigned long long MAX_THREAD_OPTION = 256;
+
+// Options that only mean something to runHeadless
+bool isHeadlessOnlyOption(const char* name) {
+    for (const char* option : {"--ticks", "--matches", "--match-ticks", "--initial-enemies", "--max-enemies", "--profile"})
+        if (std::strcmp(name, option) == 0) return true;
+    return false;
+}
+
+// Parses a whole decimal argument in [min, max]. Signs, trailing junk and
+// out-of-range values are rejected instead of wrapping the way atoi does.
+template <typename T>
+bool parseNumber(const char* text, unsigned long long min, unsigned long long max, T& value) {
+    if (!std::isdigit(static_cast<unsigned char>(text[0]))) return false;
+    errno = 0;
+    char* end = nullptr;
+    unsigned long long parsed = std::strtoull(text, &end, 10);
+    if (*end != '\0' || errno == ERANGE || parsed < min || parsed > max) return false;
+    value = static_cast<T>(parsed);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    // Every match is reproducible from its seed; without --seed the clock
+    // picks one and consecutive matches count up from it
+    std::uint64_t seed = static_cast<std::uint64_t>(std::time(nullptr));
+    bool headless = false;
+    std::string recordPath;
+    std::string replayPath;
+    HeadlessOptions headlessOptions;
+    SyncPolicy resultsSync = SyncPolicy::EveryRecord;
+    const char* headlessOnlyOption = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (isHeadlessOnlyOption(argv[i])) headlessOnlyOption = argv[i];
+        if (std::strcmp(argv[i], "--headless") == 0) headless = true;
+        else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc && parseNumber(argv[i + 1], 1, MAX_TICKS, headlessOptions.ticks)) ++i;
+        else if (std::strcmp(argv[i], "--matches") == 0 && i + 1 < argc && parseNumber(argv[i + 1], 0, MAX_TICKS, headlessOptions.matches)) ++i;
+        else if (std::strcmp(argv[i], "--match-ticks") == 0 && i + 1 < argc && parseNumber(argv[i + 1], 1, MAX_TICKS, headlessOptions.matchTicks)) ++i;
+        else if (std::strcmp(argv[i], "--initial-enemies") == 0 && i + 1 < argc && parseNumber(argv[i + 1], 0, MAX_ENEMY_OPTION, headlessOptions.world.initialEnemies)) ++i;
+        else if (std::strcmp(argv[i], "--max-enemies") == 0 && i + 1 < argc && parseNumber(argv[i + 1], 1, MAX_ENEMY_OPTION, headlessOptions.world.maxEnemies)) ++i;
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc && parseNumber(argv[i + 1], 0, ULLONG_MAX, seed)) ++i;
+        else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) recordPath = argv[++i];
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) replayPath = argv[++i];
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc && parseNumber(argv[i + 1], 1, MAX_THREAD_OPTION, headlessOptions.threads)) ++i;
+        else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc) headlessOptions.profilePath = argv[++i];
+        else if (std::strcmp(argv[i], "--fsync") == 0 && i + 1 < argc && parseSyncPolicy(argv[i + 1], resultsSync)) ++i;
+        else {
+            std::cerr << "usage: " << argv[0] << " [--headless [--ticks N] [--matches N] [--match-ticks N] [--initial-enemies N] [--max-enemies N] [--profile FILE]] [--threads N] [--seed N] [--record FILE | --replay FILE] [--fsync never|record|close]\n";
+            return 1;
+        }
+    }
+    if (headlessOnlyOption && !headless) {
+        std::cerr << headlessOnlyOption << " only applies with --headless\n";
+        return 1;
+    }
+    if (headless) {
+        headlessOptions.world.seed = seed;
+        headlessOptions.replayPath = replayPath;
+        return runHeadless(headlessOptions);
+    }
+
+    // A replay drives the player from a recording, starting from its seed
+    InputReplay replay;
+    bool replaying = !replayPath.empty();
+    if (replaying) {
+        if (!replay.open(replayPath)) {
+            std::cerr << "Could not read replay " << replayPath << "\n";
+            return 1;
+        }
+        seed = replay.getSeed();
+    }
+    InputRecorder recorder;
+    if (!recordPath.empty() && !recorder.open(recordPath, seed)) {
+        std::cerr << "Could not write " << recordPath << "\n";
+        return 1;
+    }
+
+    sf::RenderWindow window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "The Last Helldiver");
+    window.setVerticalSyncEnabled(true);
+
+    // Assets come from assets.pak when it is there: one mapping, decoded in
+    // place. Without it the loose files are read instead.
+    AssetPack pack;
+    const AssetPack* assetSource = pack.open("assets.pak") ? &pack : nullptr;
+
+    // Only the font is loaded up front so the start screen shows at once;
+    // everything else is decoded on worker threads behind it
+    sf::Font font;
+    loadAsset(font, "arial.ttf", assetSource);
+    AssetLoader loader;
+    loader.start(assetSource);
+
+    GameResources resources;
+    bool resourcesReady = false;
+    StartScreen startScreen(font);
+
+    // The leaderboard is a mapped index over every recorded match, so it
+    // shows instantly however long the log is. Its pages are left for the OS
+    // to write back, so if its file is missing, invalid or counts a different
+    // number of matches than the log holds (a crash between the two writes),
+    // it is rebuilt from the results log.
+    Leaderboard leaderboard;
+    if (leaderboard.open("leaderboard.bin") &&
+        (leaderboard.wasCreated() || leaderboard.getCount() != ResultsLog::countRecords("match_results.bin"))) {
+        leaderboard.clear();
+        for (const MatchRecord& record : ResultsLog::readAll("match_results.bin"))
+            leaderboard.insert(record.score, record.kills, record.timestamp);
+    }
+    startScreen.setLeaderboard(leaderboard);
+    GameState state = GameState::Menu;
+    bool menuNeedsRedraw = true;
+    bool startRequested = false;
+    int shownProgress = -1;
+
+    // The gameplay layer is rebuilt from the simulation state every frame as
+    // quads into one batch, so it costs one draw call and one texture bind
+    SpriteBatch gameplayBatch(&resources.atlas.getTexture());
+
+    // Separate pools for render-side frame jobs and for the simulation
+    // thread's enemy hordes: a thread waiting on a pool runs any of its
+    // queued tasks, so a shared pool would let a slow frame stall a tick and
+    // the other way round. The frame graph has two parallel jobs, so one
+    // worker beside the render thread covers it; --threads sizes the other.
+    ThreadPool renderPool(2);
+    ThreadPool simulationPool(headlessOptions.threads);
+
+    WorldConfig worldConfig;
+    worldConfig.seed = seed;
+    World world(worldConfig);
+    world.setThreadPool(&simulationPool);
+
+    Hud hud(font);
+
+    // Finished matches are appended to the results log by a background thread
+    ResultsLog resultsLog("match_results.bin", resultsSync);
+
+    // The simulation queues sound events; the mixer plays them each frame
+    SoundQueue soundQueue;
+    world.setSoundQueue(&soundQueue);
+    AudioMixer mixer(soundQueue, AUDIBLE_DISTANCE);
+
+    // While a match is on, the World belongs to the simulation thread; this
+    // thread renders the snapshots it publishes and posts input back
+    SimulationThread simulation(world, recorder.isOpen() ? &recorder : nullptr, replaying ? &replay : nullptr);
+
+    // Profiler overlay: F3 toggles it, F4 dumps the recorded frames and
+    // simulation ticks to CSV
+    Profiler profiler(FRAME_PHASES);
+    bool showProfiler = false;
+    int profilerRefresh = 0;
+    sf::Text profilerText("", font, 14);
+    profilerText.setFillColor(sf::Color::Yellow);
+    profilerText.setPosition(10, 40);
+
+    sf::Text gameOverText("", font, 32);
+    gameOverText.setFillColor(sf::Color::Red);
+    bool gameOverNeedsRedraw = false;
+
+    const RenderSnapshot* snapshot = &simulation.getSnapshot();
+    float alpha = 0.0f;
+
+    // Per-frame work on the newest snapshot is a job graph on the pool: the
+    // HUD and the gameplay vertices only read the snapshot, so they run side
+    // by side. Anything touching OpenGL or the audio device stays on this
+    // thread.
+    JobGraph frameGraph;
+    frameGraph.add([&] {
+        ProfileScope scope(&profiler, ProfilePhase::Hud);
+        hud.update(snapshot->score, snapshot->kills, snapshot->health);
+        if (showProfiler && profilerRefresh-- <= 0) {
+            profilerText.setString("frame\n" + profiler.formatReport() + "tick\n" + simulation.formatProfileReport());
+            profilerRefresh = 30;
+        }
+    });
+    frameGraph.add([&] {
+        ProfileScope scope(&profiler, ProfilePhase::Vertices);
+        gameplayBatch.clear();
+        if (resources.zoneRect.width > 0) {
+            float radius = snapshot->zonePreviousRadius + (snapshot->zoneRadius - snapshot->zonePreviousRadius) * alpha;
+            gameplayBatch.addCentered(snapshot->zoneCenter, resources.zoneRect, radius / (resources.zoneRect.width / 2.0f));
+        }
+        sf::Vector2f bulletSize(resources.bulletRect.width, resources.bulletRect.height);
+        for (std::size_t i = 0; i < snapshot->bullets.size(); ++i)
+            gameplayBatch.add(lerp(snapshot->bulletPrevious[i], snapshot->bullets[i], alpha), bulletSize, resources.bulletRect);
+        for (std::size_t i = 0; i < snapshot->enemies.size(); ++i)
+            gameplayBatch.addCentered(lerp(snapshot->enemyPrevious[i], snapshot->enemies[i], alpha), resources.enemyRect);
+        gameplayBatch.addCentered(lerp(snapshot->playerPrevious, snapshot->player, alpha), resources.playerRect);
+    });
+
+    while (window.isOpen()) {
+        // The menu is static, so once the assets are in, block in waitEvent
+        // and only redraw when the window asks for it; an idle menu costs no
+        // CPU. While loading, poll instead so progress keeps updating.
+        if (state == GameState::Menu) {
+            if (!resourcesReady && loader.isReady()) {
+                resources.upload(loader.finish());
+                mixer.setSound(SoundId::EnemyKilled, resources.shootBuffer, 2, 100.0f, 0.6f);
+                mixer.setSound(SoundId::Shoot, resources.shootBuffer, 1);
+                mixer.setSound(SoundId::EnemyHit, resources.shootBuffer, 0, 50.0f, 1.5f);
+                resourcesReady = true;
+                startScreen.setPrompt("Press ENTER to Begin Your Dive");
+                menuNeedsRedraw = true;
+            }
+            if (startRequested && resourcesReady) {
+                state = GameState::Playing;
+                startRequested = false;
+                simulation.start();
+                continue;
+            }
+            if (!resourcesReady && loader.getCompleted() != shownProgress) {
+                shownProgress = loader.getCompleted();
+                startScreen.setPrompt("Loading... " + std::to_string(shownProgress) + "/" + std::to_string(loader.getTotal()));
+                menuNeedsRedraw = true;
+            }
+            if (menuNeedsRedraw) {
+                startScreen.draw(window);
+                menuNeedsRedraw = false;
+            }
+
+            sf::Event event;
+            if (resourcesReady) {
+                if (!window.waitEvent(event)) break;
+            } else if (!window.pollEvent(event)) {
+                sf::sleep(sf::milliseconds(10));
+                continue;
+            }
+            if (event.type == sf::Event::Closed)
+                window.close();
+            else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Enter)
+                startRequested = true;
+            else if (event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus)
+                menuNeedsRedraw = true;
+            continue;
+        }
+
+        // Like the menu, the game-over screen is static: it waits for events
+        // instead of sleeping, so the window stays responsive
+        if (state == GameState::GameOver) {
+            if (gameOverNeedsRedraw) {
+                window.clear();
+                window.draw(resources.gameOverBg);
+                window.draw(gameOverText);
+                window.display();
+                gameOverNeedsRedraw = false;
+            }
+
+            sf::Event event;
+            if (!window.waitEvent(event)) break;
+            if (event.type == sf::Event::Closed) {
+                window.close();
+            } else if (event.type == sf::Event::KeyPressed &&
+                       (event.key.code == sf::Keyboard::Enter || event.key.code == sf::Keyboard::Escape)) {
+                // Back-to-back matches reuse the window, textures and entity
+                // storage; only the simulation state is reset
+                world.reset(world.getSeed() + 1);
+                mixer.stopAll();
+                if (event.key.code == sf::Keyboard::Enter) {
+                    state = GameState::Playing;
+                    simulation.start();
+                } else {
+                    startScreen.setLeaderboard(leaderboard);
+                    state = GameState::Menu;
+                    menuNeedsRedraw = true;
+                }
+            } else if (event.type == sf::Event::Resized || event.type == sf::Event::GainedFocus) {
+                gameOverNeedsRedraw = true;
+            }
+            continue;
+        }
+
+        bool fire = false;
+        {
+            ProfileScope scope(&profiler, ProfilePhase::Input);
+            sf::Event event;
+            while (window.pollEvent(event)) {
+                if (event.type == sf::Event::Closed)
+                    window.close();
+                if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left)
+                    fire = true;
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3)
+                    showProfiler = !showProfiler;
+                if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4) {
+                    if (profiler.writeCsv("profile.csv") && simulation.writeProfileCsv("profile_ticks.csv"))
+                        std::cout << "Wrote profile.csv and profile_ticks.csv\n";
+                    else std::cerr << "Could not write the profile CSVs\n";
+                }
+            }
+            if (!replaying) simulation.postInput(readPlayerInput(window, fire));
+        }
+
+        // The simulation thread ticks on its own clock; draw its newest
+        // state, interpolated by how far we are into the next tick
+        simulation.updateSnapshot();
+        snapshot = &simulation.getSnapshot();
+        alpha = snapshot->getAlpha(std::chrono::steady_clock::now());
+        mixer.update(snapshot->player.x, snapshot->player.y);
+        frameGraph.run(&renderPool);
+
+        {
+            ProfileScope scope(&profiler, ProfilePhase::Draw);
+            window.clear();
+            window.draw(resources.background);
+            window.draw(gameplayBatch);
+            window.draw(hud.getText());
+            if (showProfiler) window.draw(profilerText);
+        }
+        {
+            ProfileScope scope(&profiler, ProfilePhase::Display);
+            window.display();
+        }
+        profiler.endFrame();
+
+        // The match result is recorded once, on the frame the match ends;
+        // the log write happens on its own thread and the leaderboard is a
+        // few writes into mapped memory
+        if (snapshot->over) {
+            // The thread has stopped ticking; joining it hands the World back
+            simulation.stop();
+            std::time_t now = std::time(nullptr);
+            resultsLog.append(makeMatchRecord(now, world.getScore(), world.getKillCount(), world.getTicks()));
+            leaderboard.insert(world.getScore(), world.getKillCount(), now);
+            int beaten = static_cast<int>(leaderboard.getScorePercentile(world.getScore()) * 100.0);
+
+            gameOverText.setString("The Last Helldiver Fell\nFinal Score: " + std::to_string(world.getScore()) + " | Kills: " + std::to_string(world.getKillCount()) +
+                                   "\nBetter than " + std::to_string(beaten) + "% of dives\n\nENTER to dive again - ESC for the menu");
+            gameOverText.setPosition(WINDOW_WIDTH / 2 - gameOverText.getLocalBounds().width / 2, WINDOW_HEIGHT / 2);
+            state = GameState::GameOver;
+            gameOverNeedsRedraw = true;
+        }
+    }
+    return 0;
+}
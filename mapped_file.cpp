@@ -0,0 +1,139 @@
+#include "mapped_file.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+namespace {
+
+bool mapHandle(HANDLE file, bool write, std::size_t minimumSize, void*& mapping, unsigned char*& bytes, std::size_t& length) {
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) return false;
+    unsigned long long size = static_cast<unsigned long long>(fileSize.QuadPart);
+    if (size < minimumSize) size = minimumSize;
+    if (size == 0) return false;
+
+    // A writable mapping larger than the file extends it with zeros
+    mapping = CreateFileMappingA(file, nullptr, write ? PAGE_READWRITE : PAGE_READONLY,
+                                 static_cast<DWORD>(size >> 32), static_cast<DWORD>(size), nullptr);
+    if (!mapping) return false;
+    bytes = static_cast<unsigned char*>(MapViewOfFile(mapping, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0));
+    if (!bytes) return false;
+    length = static_cast<std::size_t>(size);
+    return true;
+}
+
+}
+
+MappedFile::MappedFile()
+    : bytes(nullptr), length(0), writable(false), fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr) {}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+    fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE || !mapHandle(fileHandle, false, 0, mappingHandle, bytes, length)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::openWritable(const std::string& path, std::size_t minimumSize) {
+    close();
+    fileHandle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS,
+                             FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE || !mapHandle(fileHandle, true, minimumSize, mappingHandle, bytes, length)) {
+        close();
+        return false;
+    }
+    writable = true;
+    return true;
+}
+
+bool MappedFile::flush() {
+    if (!bytes || !writable) return false;
+    return FlushViewOfFile(bytes, 0) && FlushFileBuffers(fileHandle);
+}
+
+void MappedFile::close() {
+    if (bytes) UnmapViewOfFile(bytes);
+    if (mappingHandle) CloseHandle(mappingHandle);
+    if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+    bytes = nullptr;
+    length = 0;
+    writable = false;
+    mappingHandle = nullptr;
+    fileHandle = INVALID_HANDLE_VALUE;
+}
+
+#else
+
+namespace {
+
+bool mapDescriptor(int fd, bool write, std::size_t minimumSize, unsigned char*& bytes, std::size_t& length) {
+    struct stat info;
+    if (fstat(fd, &info) != 0) return false;
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    if (size < minimumSize) {
+        if (!write || ftruncate(fd, static_cast<off_t>(minimumSize)) != 0) return false;
+        size = minimumSize;
+    }
+    if (size == 0) return false;
+
+    void* mapping = write ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                          : mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) return false;
+    bytes = static_cast<unsigned char*>(mapping);
+    length = size;
+    return true;
+}
+
+}
+
+MappedFile::MappedFile() : bytes(nullptr), length(0), writable(false) {}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    bool mapped = mapDescriptor(fd, false, 0, bytes, length);
+    // The mapping keeps the file alive on its own
+    ::close(fd);
+    return mapped;
+}
+
+bool MappedFile::openWritable(const std::string& path, std::size_t minimumSize) {
+    close();
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return false;
+    bool mapped = mapDescriptor(fd, true, minimumSize, bytes, length);
+    ::close(fd);
+    writable = mapped;
+    return mapped;
+}
+
+bool MappedFile::flush() {
+    if (!bytes || !writable) return false;
+    return msync(bytes, length, MS_SYNC) == 0;
+}
+
+void MappedFile::close() {
+    if (bytes) munmap(bytes, length);
+    bytes = nullptr;
+    length = 0;
+    writable = false;
+}
+
+#endif
+
+MappedFile::~MappedFile() { close(); }
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+// Memory mapping of a whole file, read-only or shared read-write. The bytes
+// stay valid until the MappedFile is closed or destroyed.
+class MappedFile {
+private:
+    unsigned char* bytes;
+    std::size_t length;
+    bool writable;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+
+public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path);
+    // Maps the file for writing, creating it or growing it with zeros to at
+    // least minimumSize first. Writes go straight to the page cache.
+    bool openWritable(const std::string& path, std::size_t minimumSize);
+    // Asks the OS to write dirty pages back to disk now.
+    bool flush();
+    void close();
+
+    bool isOpen() const { return bytes != nullptr; }
+    const unsigned char* data() const { return bytes; }
+    // Only valid for writable mappings.
+    unsigned char* mutableData() { return writable ? bytes : nullptr; }
+    std::size_t size() const { return length; }
+};
@@ -0,0 +1,29 @@
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "asset_pack.hpp"
+
+// Builds and checks the single-file asset pack the game maps at startup.
+//   pack_assets OUTPUT.pak FILE...   pack the files under their base names
+//   pack_assets --verify PACK.pak    list the index and check every CRC
+int main(int argc, char* argv[]) {
+    if (argc == 3 && std::strcmp(argv[1], "--verify") == 0) {
+        AssetPack pack;
+        if (!pack.open(argv[2])) return 1;
+        for (std::uint32_t i = 0; i < pack.getCount(); ++i) {
+            const PackEntry& entry = pack.getEntry(i);
+            std::cout << pack.getName(i) << "  " << entry.size << " bytes @ " << entry.offset << "\n";
+        }
+        std::vector<std::string> corrupt = pack.verify();
+        for (const std::string& name : corrupt) std::cerr << "CRC mismatch: " << name << "\n";
+        std::cout << (corrupt.empty() ? "OK\n" : "CORRUPT\n");
+        return corrupt.empty() ? 0 : 1;
+    }
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " OUTPUT.pak FILE...\n"
+                  << "       " << argv[0] << " --verify PACK.pak\n";
+        return 1;
+    }
+    return writeAssetPack(argv[1], std::vector<std::string>(argv + 2, argv + argc)) ? 0 : 1;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Fixed-capacity, densely packed pool. Storage is allocated once up front and
+// never grows: spawning into a full pool fails, and removal moves the last
+// element into the hole, so both are O(1) and allocation-free. Removal does
+// not preserve order.
+template <typename T>
+class FixedPool {
+private:
+    std::vector<T> items;
+    std::size_t capacity;
+
+public:
+    explicit FixedPool(std::size_t capacity = 0) : capacity(capacity) { items.reserve(capacity); }
+
+    template <typename... Args>
+    bool spawn(Args&&... args) {
+        if (items.size() >= capacity) return false;
+        items.emplace_back(std::forward<Args>(args)...);
+        return true;
+    }
+
+    void removeAt(std::size_t i) {
+        if (i + 1 != items.size()) items[i] = std::move(items.back());
+        items.pop_back();
+    }
+
+    void clear() { items.clear(); }
+
+    std::size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+    bool full() const { return items.size() >= capacity; }
+    std::size_t getCapacity() const { return capacity; }
+
+    T& operator[](std::size_t i) { return items[i]; }
+    const T& operator[](std::size_t i) const { return items[i]; }
+    typename std::vector<T>::const_iterator begin() const { return items.begin(); }
+    typename std::vector<T>::const_iterator end() const { return items.end(); }
+};
@@ -0,0 +1,86 @@
+#include "profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+Profiler::Profiler(unsigned phaseMask, int historySize) : historySize(historySize) {
+    for (int p = 0; p < PROFILE_PHASES; ++p)
+        if (phaseMask & phaseBit(static_cast<ProfilePhase>(p))) phases[phaseCount++] = static_cast<ProfilePhase>(p);
+    if (historySize > 0) history.resize(static_cast<std::size_t>(historySize) * phaseCount);
+}
+
+void Profiler::endFrame() {
+    if (historySize == 0) {
+        for (int c = 0; c < phaseCount; ++c) history.push_back(current[static_cast<int>(phases[c])]);
+        ++frames;
+    } else {
+        double* row = &history[static_cast<std::size_t>(next) * phaseCount];
+        for (int c = 0; c < phaseCount; ++c) row[c] = current[static_cast<int>(phases[c])];
+        next = (next + 1) % historySize;
+        frames = std::min(frames + 1, historySize);
+    }
+    std::fill(current, current + PROFILE_PHASES, 0.0);
+}
+
+PhaseStats Profiler::getStats(ProfilePhase phase) const {
+    PhaseStats stats;
+    int column = 0;
+    while (column < phaseCount && phases[column] != phase) ++column;
+    if (frames == 0 || column == phaseCount) return stats;
+
+    std::vector<double> sorted(frames);
+    double sum = 0;
+    for (int f = 0; f < frames; ++f) {
+        sorted[f] = history[static_cast<std::size_t>(f) * phaseCount + column];
+        sum += sorted[f];
+    }
+    std::sort(sorted.begin(), sorted.end());
+    stats.min = sorted[0];
+    stats.avg = sum / frames;
+    stats.p99 = sorted[std::min(frames - 1, static_cast<int>(frames * 99LL / 100))];
+    return stats;
+}
+
+std::string Profiler::formatReport() const {
+    std::string report = "phase          min       avg       p99  (us)\n";
+    char line[64];
+    for (int c = 0; c < phaseCount; ++c) {
+        PhaseStats stats = getStats(phases[c]);
+        std::snprintf(line, sizeof(line), "%-10s %8.1f  %8.1f  %8.1f\n", phaseName(phases[c]), stats.min, stats.avg, stats.p99);
+        report += line;
+    }
+    return report;
+}
+
+bool Profiler::writeCsv(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) return false;
+
+    file << "frame";
+    for (int c = 0; c < phaseCount; ++c) file << ',' << phaseName(phases[c]);
+    file << '\n';
+
+    int oldest = historySize == 0 || frames < historySize ? 0 : next;
+    for (int f = 0; f < frames; ++f) {
+        std::size_t row = historySize == 0 ? f : (oldest + f) % historySize;
+        file << f;
+        for (int c = 0; c < phaseCount; ++c) file << ',' << history[row * phaseCount + c];
+        file << '\n';
+    }
+    return static_cast<bool>(file);
+}
+
+const char* Profiler::phaseName(ProfilePhase phase) {
+    switch (phase) {
+        case ProfilePhase::Input: return "input";
+        case ProfilePhase::Bullets: return "bullets";
+        case ProfilePhase::Enemies: return "enemies";
+        case ProfilePhase::Collision: return "collision";
+        case ProfilePhase::SafeZone: return "safezone";
+        case ProfilePhase::Hud: return "hud";
+        case ProfilePhase::Vertices: return "vertices";
+        case ProfilePhase::Draw: return "draw";
+        case ProfilePhase::Display: return "display";
+        default: return "?";
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <chrono>
+#include <string>
+#include <vector>
+
+enum class ProfilePhase { Input, Bullets, Enemies, Collision, SafeZone, Hud, Vertices, Draw, Display, Count };
+
+const int PROFILE_PHASES = static_cast<int>(ProfilePhase::Count);
+
+constexpr unsigned phaseBit(ProfilePhase phase) { return 1u << static_cast<int>(phase); }
+
+// The phases each side of the game enters: World::step() on one side, the
+// window's frame loop on the other
+const unsigned SIMULATION_PHASES = phaseBit(ProfilePhase::Bullets) | phaseBit(ProfilePhase::Enemies) |
+                                   phaseBit(ProfilePhase::Collision) | phaseBit(ProfilePhase::SafeZone);
+const unsigned FRAME_PHASES = phaseBit(ProfilePhase::Input) | phaseBit(ProfilePhase::Hud) | phaseBit(ProfilePhase::Vertices) |
+                              phaseBit(ProfilePhase::Draw) | phaseBit(ProfilePhase::Display);
+const unsigned ALL_PHASES = SIMULATION_PHASES | FRAME_PHASES;
+
+struct PhaseStats {
+    double min = 0;
+    double avg = 0;
+    double p99 = 0;
+};
+
+// Per-phase frame timings for the phases in its mask, over the last
+// historySize frames (0 keeps every frame). A phase can be entered several
+// times per frame (one simulation tick each); its time is summed until
+// endFrame() commits the frame. Times are in microseconds.
+// Phases may run at the same time on different threads (each only adds to
+// its own slot), so their sum can exceed the frame time.
+class Profiler {
+public:
+    static const int PROFILE_HISTORY = 240;
+
+private:
+    int historySize;
+    ProfilePhase phases[PROFILE_PHASES];
+    int phaseCount = 0;
+    double current[PROFILE_PHASES] = {};
+    // One row of phaseCount values per frame
+    std::vector<double> history;
+    int next = 0;
+    int frames = 0;
+
+public:
+    explicit Profiler(unsigned phaseMask = ALL_PHASES, int historySize = PROFILE_HISTORY);
+
+    void add(ProfilePhase phase, double us) { current[static_cast<int>(phase)] += us; }
+    void endFrame();
+
+    PhaseStats getStats(ProfilePhase phase) const;
+    // One line per recorded phase: name, min, avg and p99 in us.
+    std::string formatReport() const;
+    // Writes the recorded frames oldest first, one row per frame and one
+    // column per recorded phase.
+    bool writeCsv(const std::string& path) const;
+
+    static const char* phaseName(ProfilePhase phase);
+};
+
+// Adds the time between construction and destruction to a phase; a null
+// profiler makes it a no-op so profiling can be switched off.
+class ProfileScope {
+private:
+    Profiler* profiler;
+    ProfilePhase phase;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    ProfileScope(Profiler* profiler, ProfilePhase phase) : profiler(profiler), phase(phase) {
+        if (profiler) start = std::chrono::steady_clock::now();
+    }
+    ~ProfileScope() {
+        if (profiler)
+            profiler->add(phase, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
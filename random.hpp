@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+
+// Subsystems that draw random numbers. Each gets its own stream so, for
+// example, a cosmetic effect rolling an extra number never changes where the
+// next enemy spawns.
+enum class RandomStream : std::uint64_t {
+    Spawn,     // enemy placement
+    Ai,        // enemy behaviour, currently their speed
+    Effects    // presentation only; must never feed back into the simulation
+};
+
+// SplitMix64 step, used to expand a 64-bit seed into generator state.
+inline std::uint64_t splitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// xoshiro128** generator: 16 bytes of state, a handful of ALU ops per number
+// and no shared state, so each thread or subsystem can own one. The same
+// seed and stream always produce the same sequence on every platform.
+class Random {
+private:
+    std::uint32_t s[4];
+
+    static std::uint32_t rotl(std::uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+public:
+    explicit Random(std::uint64_t seed = 0, RandomStream stream = RandomStream::Spawn) { reseed(seed, stream); }
+
+    void reseed(std::uint64_t seed, RandomStream stream = RandomStream::Spawn) {
+        // Mixing the stream id in first gives unrelated sequences per stream
+        std::uint64_t state = seed ^ (static_cast<std::uint64_t>(stream) * 0xD1B54A32D192ED03ull);
+        std::uint64_t a = splitMix64(state);
+        std::uint64_t b = splitMix64(state);
+        s[0] = static_cast<std::uint32_t>(a);
+        s[1] = static_cast<std::uint32_t>(a >> 32);
+        s[2] = static_cast<std::uint32_t>(b);
+        s[3] = static_cast<std::uint32_t>(b >> 32);
+    }
+
+    std::uint32_t next() {
+        std::uint32_t result = rotl(s[1] * 5, 7) * 9;
+        std::uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 11);
+        return result;
+    }
+
+    // Uniform in [0, bound) by multiply-shift; the bias is negligible for the
+    // small bounds the game uses.
+    std::uint32_t nextBelow(std::uint32_t bound) {
+        return static_cast<std::uint32_t>((static_cast<std::uint64_t>(next()) * bound) >> 32);
+    }
+
+    // Uniform in [0, 1).
+    float nextFloat() { return (next() >> 8) * (1.0f / 16777216.0f); }
+};
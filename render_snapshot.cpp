@@ -0,0 +1,49 @@
+#include "render_snapshot.hpp"
+#include <algorithm>
+
+void RenderSnapshot::reserve(std::size_t maxEnemies, std::size_t maxBullets) {
+    enemyPrevious.reserve(maxEnemies);
+    enemies.reserve(maxEnemies);
+    bulletPrevious.reserve(maxBullets);
+    bullets.reserve(maxBullets);
+}
+
+void RenderSnapshot::capture(const World& world) {
+    time = std::chrono::steady_clock::now();
+    ticks = world.getTicks();
+
+    const Player& p = world.getPlayer();
+    playerPrevious = p.getInterpolatedPosition(0.0f);
+    player = p.getPosition();
+
+    const EnemyStore& store = world.getEnemies();
+    enemyPrevious.resize(store.size());
+    enemies.resize(store.size());
+    for (std::size_t i = 0; i < store.size(); ++i) {
+        enemyPrevious[i] = sf::Vector2f(store.prevX[i], store.prevY[i]);
+        enemies[i] = sf::Vector2f(store.x[i], store.y[i]);
+    }
+
+    const FixedPool<Bullet>& pool = world.getBullets();
+    bulletPrevious.resize(pool.size());
+    bullets.resize(pool.size());
+    for (std::size_t i = 0; i < pool.size(); ++i) {
+        bulletPrevious[i] = pool[i].getInterpolatedPosition(0.0f);
+        bullets[i] = pool[i].getPosition();
+    }
+
+    const SafeZone& zone = world.getSafeZone();
+    zoneCenter = zone.getCenter();
+    zonePreviousRadius = zone.getInterpolatedRadius(0.0f);
+    zoneRadius = zone.getRadius();
+
+    score = world.getScore();
+    kills = world.getKillCount();
+    health = p.getHealth();
+    over = world.isOver();
+}
+
+float RenderSnapshot::getAlpha(std::chrono::steady_clock::time_point now) const {
+    float elapsed = std::chrono::duration<float>(now - time).count();
+    return std::min(std::max(elapsed / SIM_STEP, 0.0f), 1.0f);
+}
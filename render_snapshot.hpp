@@ -0,0 +1,34 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+#include "world.hpp"
+
+// Everything the renderer needs from one simulation tick, copied out of the
+// World so drawing never touches live simulation state. Positions come in
+// previous/current pairs for interpolation between ticks.
+struct RenderSnapshot {
+    std::chrono::steady_clock::time_point time;   // when the tick finished
+    unsigned ticks = 0;
+    sf::Vector2f playerPrevious;
+    sf::Vector2f player;
+    std::vector<sf::Vector2f> enemyPrevious;
+    std::vector<sf::Vector2f> enemies;
+    std::vector<sf::Vector2f> bulletPrevious;
+    std::vector<sf::Vector2f> bullets;
+    sf::Vector2f zoneCenter;
+    float zonePreviousRadius = 0.0f;
+    float zoneRadius = 0.0f;
+    int score = 0;
+    int kills = 0;
+    int health = 0;
+    bool over = false;
+
+    // Sizes the arrays for the World's caps so capturing never allocates.
+    void reserve(std::size_t maxEnemies, std::size_t maxBullets);
+    void capture(const World& world);
+
+    // How far the renderer is from this tick towards the next one, in [0, 1].
+    float getAlpha(std::chrono::steady_clock::time_point now) const;
+};
@@ -0,0 +1,140 @@
+#include "results_log.hpp"
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include "crc32.hpp"
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const std::uint32_t RECORD_MAGIC = 0x52444C48;   // "HLDR"
+const std::uint32_t RECORD_VERSION = 1;
+
+std::uint32_t recordChecksum(const MatchRecord& record) {
+    return crc32(&record, offsetof(MatchRecord, checksum));
+}
+
+#ifdef _WIN32
+int openForAppend(const char* path) { return _open(path, _O_WRONLY | _O_APPEND | _O_CREAT | _O_BINARY, _S_IREAD | _S_IWRITE); }
+long long fileSize(int fd) { return _filelengthi64(fd); }
+bool truncateTo(int fd, long long size) { return _chsize_s(fd, size) == 0; }
+bool writeAll(int fd, const void* data, std::size_t size) { return _write(fd, data, static_cast<unsigned>(size)) == static_cast<int>(size); }
+void syncFile(int fd) { _commit(fd); }
+void closeFile(int fd) { _close(fd); }
+#else
+int openForAppend(const char* path) { return ::open(path, O_WRONLY | O_APPEND | O_CREAT, 0644); }
+long long fileSize(int fd) {
+    struct stat info;
+    return fstat(fd, &info) == 0 ? static_cast<long long>(info.st_size) : -1;
+}
+bool truncateTo(int fd, long long size) { return ftruncate(fd, static_cast<off_t>(size)) == 0; }
+bool writeAll(int fd, const void* data, std::size_t size) { return ::write(fd, data, size) == static_cast<ssize_t>(size); }
+void syncFile(int fd) { fsync(fd); }
+void closeFile(int fd) { ::close(fd); }
+#endif
+
+}
+
+MatchRecord makeMatchRecord(std::int64_t timestamp, int score, int kills, std::uint32_t ticks) {
+    MatchRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.magic = RECORD_MAGIC;
+    record.version = RECORD_VERSION;
+    record.timestamp = timestamp;
+    record.score = score;
+    record.kills = kills;
+    record.ticks = ticks;
+    record.checksum = recordChecksum(record);
+    return record;
+}
+
+bool isValidMatchRecord(const MatchRecord& record) {
+    return record.magic == RECORD_MAGIC && record.version == RECORD_VERSION &&
+           record.checksum == recordChecksum(record);
+}
+
+ResultsLog::ResultsLog(const std::string& path, SyncPolicy policy)
+    : path(path), policy(policy), stopping(false), fd(-1) {
+    writer = std::thread(&ResultsLog::run, this);
+}
+
+ResultsLog::~ResultsLog() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    writer.join();
+}
+
+void ResultsLog::append(const MatchRecord& record) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(record);
+    }
+    wake.notify_one();
+}
+
+void ResultsLog::run() {
+    std::vector<MatchRecord> batch;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !pending.empty(); });
+            if (pending.empty() && stopping) break;
+            batch.swap(pending);
+        }
+        writeRecords(batch);
+        batch.clear();
+    }
+
+    if (fd >= 0) {
+        if (policy == SyncPolicy::OnClose) syncFile(fd);
+        closeFile(fd);
+    }
+}
+
+void ResultsLog::writeRecords(const std::vector<MatchRecord>& records) {
+    if (fd < 0) {
+        fd = openForAppend(path.c_str());
+        if (fd < 0) {
+            std::cerr << "Cannot open " << path << "; match results are not being saved\n";
+            return;
+        }
+        // A crash mid-append can leave a partial record at the end. Cut it
+        // off so new records stay aligned to the record size.
+        long long size = fileSize(fd);
+        if (size > 0 && size % sizeof(MatchRecord) != 0)
+            truncateTo(fd, size - size % sizeof(MatchRecord));
+    }
+
+    if (!writeAll(fd, records.data(), records.size() * sizeof(MatchRecord)))
+        std::cerr << "Failed to append to " << path << "\n";
+    if (policy == SyncPolicy::EveryRecord) syncFile(fd);
+}
+
+std::vector<MatchRecord> ResultsLog::readAll(const std::string& path) {
+    std::vector<MatchRecord> records;
+    std::ifstream in(path, std::ios::binary);
+    MatchRecord record;
+    while (in.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        if (isValidMatchRecord(record)) records.push_back(record);
+    }
+    return records;
+}
+
+std::uint64_t ResultsLog::countRecords(const std::string& path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) return 0;
+    return static_cast<std::uint64_t>(in.tellg()) / sizeof(MatchRecord);
+}
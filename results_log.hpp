@@ -0,0 +1,63 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// One finished match as stored in the results log: a fixed 32-byte
+// little-endian record whose checksum lets readers skip a torn tail.
+struct MatchRecord {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::int64_t timestamp;   // seconds since the epoch
+    std::int32_t score;
+    std::int32_t kills;
+    std::uint32_t ticks;      // match length in simulation ticks
+    std::uint32_t checksum;   // CRC-32 of the preceding 28 bytes
+};
+
+static_assert(sizeof(MatchRecord) == 32, "MatchRecord must match the on-disk layout");
+
+MatchRecord makeMatchRecord(std::int64_t timestamp, int score, int kills, std::uint32_t ticks);
+bool isValidMatchRecord(const MatchRecord& record);
+
+enum class SyncPolicy {
+    Never,         // leave flushing to the OS
+    EveryRecord,   // fsync after each append
+    OnClose        // fsync once when the writer shuts down
+};
+
+// Append-only binary log of match results, written by a background thread so
+// the frame that ends a match never waits on the disk. Each record goes out
+// in a single append-mode write, so a crash can at worst leave a partial
+// last record, which readers detect and ignore.
+class ResultsLog {
+private:
+    std::string path;
+    SyncPolicy policy;
+    std::vector<MatchRecord> pending;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping;
+    int fd;
+    std::thread writer;
+
+    void run();
+    void writeRecords(const std::vector<MatchRecord>& records);
+
+public:
+    ResultsLog(const std::string& path, SyncPolicy policy);
+    ~ResultsLog();
+    ResultsLog(const ResultsLog&) = delete;
+    ResultsLog& operator=(const ResultsLog&) = delete;
+
+    // Queues the record and returns at once.
+    void append(const MatchRecord& record);
+
+    // Reads every intact record from a log file.
+    static std::vector<MatchRecord> readAll(const std::string& path);
+    // Number of whole records in a log file, intact or not, from its size.
+    static std::uint64_t countRecords(const std::string& path);
+};
@@ -0,0 +1,96 @@
+#include "sim_thread.hpp"
+#include <SFML/System.hpp>
+#include <chrono>
+
+void InputMailbox::post(const PlayerInput& input) {
+    std::lock_guard<std::mutex> lock(mutex);
+    bool pendingFire = latest.fire;
+    latest = input;
+    latest.fire = latest.fire || pendingFire;
+}
+
+PlayerInput InputMailbox::take() {
+    std::lock_guard<std::mutex> lock(mutex);
+    PlayerInput input = latest;
+    latest.fire = false;
+    return input;
+}
+
+SimulationThread::SimulationThread(World& world, InputRecorder* recorder, InputReplay* replay)
+    : world(world), recorder(recorder), replay(replay), profiler(SIMULATION_PHASES), stopRequested(false) {
+    for (unsigned i = 0; i < 3; ++i)
+        snapshots.slot(i).reserve(world.getConfig().maxEnemies, world.getConfig().maxBullets);
+    world.setProfiler(&profiler);
+}
+
+SimulationThread::~SimulationThread() {
+    stop();
+    world.setProfiler(nullptr);
+}
+
+void SimulationThread::start() {
+    stop();
+    // Published here, before the thread exists, so the first frame of a new
+    // match never shows the last snapshot of the previous one
+    snapshots.writeBuffer().capture(world);
+    snapshots.publish();
+    stopRequested.store(false, std::memory_order_relaxed);
+    thread = std::thread(&SimulationThread::run, this);
+}
+
+void SimulationThread::stop() {
+    if (!thread.joinable()) return;
+    stopRequested.store(true, std::memory_order_release);
+    thread.join();
+}
+
+void SimulationThread::run() {
+    typedef std::chrono::steady_clock Clock;
+    const Clock::duration tick = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(SIM_STEP));
+    const Clock::duration maxLag = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(MAX_FRAME_TIME));
+    const Clock::duration sleepMargin = std::chrono::milliseconds(2);
+
+    Clock::time_point next = Clock::now() + tick;
+    while (!stopRequested.load(std::memory_order_acquire) && !world.isOver()) {
+        Clock::time_point now = Clock::now();
+        if (now < next) {
+            // sf::sleep raises the timer resolution on Windows, where a plain
+            // sleep can overshoot a whole tick; the last stretch is spun
+            // through with yields so the tick lands on time
+            Clock::duration remaining = next - now;
+            if (remaining > sleepMargin)
+                sf::sleep(sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(remaining - sleepMargin).count()));
+            else
+                std::this_thread::yield();
+            continue;
+        }
+        // After a long stall, drop the time instead of spiralling through
+        // a backlog of ticks
+        if (now - next > maxLag) next = now;
+
+        PlayerInput input;
+        if (replay) replay->next(input);
+        else input = inputs.take();
+        world.setInput(input);
+        if (recorder) recorder->record(world.getInput());
+        world.step(SIM_STEP);
+        {
+            std::lock_guard<std::mutex> lock(profilerMutex);
+            profiler.endFrame();
+        }
+        next += tick;
+
+        snapshots.writeBuffer().capture(world);
+        snapshots.publish();
+    }
+}
+
+std::string SimulationThread::formatProfileReport() const {
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    return profiler.formatReport();
+}
+
+bool SimulationThread::writeProfileCsv(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(profilerMutex);
+    return profiler.writeCsv(path);
+}
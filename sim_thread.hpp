@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "input_log.hpp"
+#include "profiler.hpp"
+#include "render_snapshot.hpp"
+#include "triple_buffer.hpp"
+#include "world.hpp"
+
+// Latest player input from the render thread. Like World::setInput, a fire
+// request stays pending until the simulation takes it.
+class InputMailbox {
+private:
+    std::mutex mutex;
+    PlayerInput latest;
+
+public:
+    void post(const PlayerInput& input);
+    PlayerInput take();
+};
+
+// Runs the World's fixed ticks in real time on its own thread, so a slow
+// present never delays the simulation and vice versa. After every tick it
+// publishes a RenderSnapshot through a triple buffer; the render thread
+// only ever reads snapshots while this is running, and may touch the World
+// again once stop() has returned. Sound events already cross threads through
+// the World's SPSC sound queue.
+class SimulationThread {
+private:
+    World& world;
+    InputRecorder* recorder;
+    InputReplay* replay;
+    InputMailbox inputs;
+    TripleBuffer<RenderSnapshot> snapshots;
+    Profiler profiler;
+    mutable std::mutex profilerMutex;
+    std::atomic<bool> stopRequested;
+    std::thread thread;
+
+    void run();
+
+public:
+    // The recorder, if any, gets every tick's input; a replay, if any,
+    // replaces the mailbox as the input source.
+    SimulationThread(World& world, InputRecorder* recorder, InputReplay* replay);
+    ~SimulationThread();
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // Publishes the World's current state, then starts ticking. The thread
+    // ends by itself when the match is over.
+    void start();
+    // Asks the thread to finish and waits for it.
+    void stop();
+    bool isRunning() const { return thread.joinable(); }
+
+    // Render side.
+    void postInput(const PlayerInput& input) { inputs.post(input); }
+    // Moves to the newest snapshot; false if there is nothing new.
+    bool updateSnapshot() { return snapshots.update(); }
+    const RenderSnapshot& getSnapshot() const { return snapshots.readBuffer(); }
+
+    // Per-tick phase timings, safe to call while the thread runs.
+    std::string formatProfileReport() const;
+    bool writeProfileCsv(const std::string& path) const;
+};
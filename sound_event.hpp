@@ -0,0 +1,17 @@
+#pragma once
+#include "spsc_queue.hpp"
+
+enum class SoundId { Shoot, EnemyHit, EnemyKilled, Count };
+
+const int SOUND_IDS = static_cast<int>(SoundId::Count);
+
+// A request from the simulation to play a sound at a world position. The
+// simulation only ever pushes these; the AudioMixer on the render thread
+// is the one that talks to the audio device.
+struct SoundEvent {
+    SoundId id = SoundId::Shoot;
+    float x = 0;
+    float y = 0;
+};
+
+typedef SpscQueue<SoundEvent, 256> SoundQueue;
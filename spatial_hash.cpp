@@ -0,0 +1,40 @@
+#include "spatial_hash.hpp"
+#include <algorithm>
+#include <cmath>
+
+SpatialHash::SpatialHash(float cellSize, float width, float height)
+    : invCellSize(1.0f / cellSize),
+      cols(std::max(1, static_cast<int>(std::ceil(width / cellSize)))),
+      rows(std::max(1, static_cast<int>(std::ceil(height / cellSize)))),
+      cellStart(cols * rows + 1, 0), cursor(cols * rows, 0) {}
+
+int SpatialHash::column(float x) const {
+    int c = static_cast<int>(std::floor(x * invCellSize));
+    return std::min(std::max(c, 0), cols - 1);
+}
+
+int SpatialHash::row(float y) const {
+    int r = static_cast<int>(std::floor(y * invCellSize));
+    return std::min(std::max(r, 0), rows - 1);
+}
+
+void SpatialHash::reserve(std::size_t capacity) {
+    itemCell.reserve(capacity);
+    items.reserve(capacity);
+}
+
+void SpatialHash::build(const float* x, const float* y, std::size_t count) {
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    itemCell.resize(count);
+    items.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        int cell = row(y[i]) * cols + column(x[i]);
+        itemCell[i] = cell;
+        ++cellStart[cell + 1];
+    }
+    for (std::size_t c = 1; c < cellStart.size(); ++c) cellStart[c] += cellStart[c - 1];
+
+    std::copy(cellStart.begin(), cellStart.end() - 1, cursor.begin());
+    for (std::size_t i = 0; i < count; ++i) items[cursor[itemCell[i]]++] = static_cast<int>(i);
+}
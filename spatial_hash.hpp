@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// Uniform grid broadphase over the play area, rebuilt from scratch every tick
+// with a counting sort so each cell's entries are contiguous and in index
+// order. Positions outside the grid are clamped into the border cells; since
+// queries clamp the same way, nothing off-screen is ever missed.
+class SpatialHash {
+private:
+    float invCellSize;
+    int cols;
+    int rows;
+    std::vector<int> cellStart;   // cell c holds items[cellStart[c] .. cellStart[c + 1])
+    std::vector<int> cursor;
+    std::vector<int> itemCell;
+    std::vector<int> items;
+
+    int column(float x) const;
+    int row(float y) const;
+
+public:
+    SpatialHash(float cellSize, float width, float height);
+
+    void reserve(std::size_t capacity);
+
+    void build(const float* x, const float* y, std::size_t count);
+
+    // Calls visit(index) for every item in the cells overlapping the square
+    // of half-size radius around (x, y). Candidates still need an exact test.
+    template <typename Visit>
+    void query(float x, float y, float radius, Visit&& visit) const {
+        int c0 = column(x - radius), c1 = column(x + radius);
+        int r0 = row(y - radius), r1 = row(y + radius);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                int cell = r * cols + c;
+                for (int k = cellStart[cell]; k < cellStart[cell + 1]; ++k) visit(items[k]);
+            }
+        }
+    }
+};
@@ -0,0 +1,30 @@
+#include "sprite_batch.hpp"
+
+SpriteBatch::SpriteBatch(const sf::Texture* texture)
+    : vertices(sf::Triangles), texture(texture) {}
+
+void SpriteBatch::add(const sf::Vector2f& topLeft, const sf::Vector2f& size, const sf::IntRect& textureRect,
+                      const sf::Color& color) {
+    float left = topLeft.x, top = topLeft.y;
+    float right = left + size.x, bottom = top + size.y;
+    float u0 = textureRect.left, v0 = textureRect.top;
+    float u1 = u0 + textureRect.width, v1 = v0 + textureRect.height;
+
+    vertices.append(sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(u0, v0)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, top), color, sf::Vector2f(u1, v0)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u1, v1)));
+    vertices.append(sf::Vertex(sf::Vector2f(left, top), color, sf::Vector2f(u0, v0)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, bottom), color, sf::Vector2f(u1, v1)));
+    vertices.append(sf::Vertex(sf::Vector2f(left, bottom), color, sf::Vector2f(u0, v1)));
+}
+
+void SpriteBatch::addCentered(const sf::Vector2f& center, const sf::IntRect& textureRect, float scale) {
+    sf::Vector2f size(textureRect.width * scale, textureRect.height * scale);
+    add(sf::Vector2f(center.x - size.x / 2, center.y - size.y / 2), size, textureRect);
+}
+
+void SpriteBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (vertices.getVertexCount() == 0) return;
+    states.texture = texture;
+    target.draw(vertices, states);
+}
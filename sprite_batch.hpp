@@ -0,0 +1,25 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// Collects textured quads into one vertex array so a whole layer of sprites
+// sharing a texture costs a single draw call, however many there are. The
+// array is cleared, not freed, each frame, so it stops allocating once it
+// has grown to the largest frame seen.
+class SpriteBatch : public sf::Drawable {
+private:
+    sf::VertexArray vertices;
+    const sf::Texture* texture;
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+public:
+    explicit SpriteBatch(const sf::Texture* texture = nullptr);
+
+    void setTexture(const sf::Texture* newTexture) { texture = newTexture; }
+    void clear() { vertices.clear(); }
+    void add(const sf::Vector2f& topLeft, const sf::Vector2f& size, const sf::IntRect& textureRect,
+             const sf::Color& color = sf::Color::White);
+    // Quad for the texture region, scaled and centred on center.
+    void addCentered(const sf::Vector2f& center, const sf::IntRect& textureRect, float scale = 1.0f);
+    std::size_t getQuadCount() const { return vertices.getVertexCount() / 6; }
+};
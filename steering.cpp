@@ -0,0 +1,103 @@
+#include "steering.hpp"
+#include <cmath>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STEERING_X86 1
+#include <immintrin.h>
+#endif
+
+void steerTowardsScalar(const float* x, const float* y, const float* speed, float* vx, float* vy,
+                        std::size_t count, float targetX, float targetY) {
+    for (std::size_t i = 0; i < count; ++i) {
+        float dx = targetX - x[i];
+        float dy = targetY - y[i];
+        float length = std::sqrt(dx * dx + dy * dy);
+        if (length > 0) {
+            vx[i] = (dx / length) * speed[i];
+            vy[i] = (dy / length) * speed[i];
+        }
+    }
+}
+
+#ifdef STEERING_X86
+
+namespace {
+
+// Lanes with a zero length keep their old velocity, like the scalar branch.
+__attribute__((target("sse2")))
+void steerSse(const float* x, const float* y, const float* speed, float* vx, float* vy,
+              std::size_t count, float targetX, float targetY) {
+    const __m128 tx = _mm_set1_ps(targetX), ty = _mm_set1_ps(targetY), zero = _mm_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_sub_ps(tx, _mm_loadu_ps(x + i));
+        __m128 dy = _mm_sub_ps(ty, _mm_loadu_ps(y + i));
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+        __m128 moving = _mm_cmpgt_ps(length, zero);
+        __m128 s = _mm_loadu_ps(speed + i);
+        __m128 nx = _mm_mul_ps(_mm_div_ps(dx, length), s);
+        __m128 ny = _mm_mul_ps(_mm_div_ps(dy, length), s);
+        __m128 oldX = _mm_loadu_ps(vx + i), oldY = _mm_loadu_ps(vy + i);
+        _mm_storeu_ps(vx + i, _mm_or_ps(_mm_and_ps(moving, nx), _mm_andnot_ps(moving, oldX)));
+        _mm_storeu_ps(vy + i, _mm_or_ps(_mm_and_ps(moving, ny), _mm_andnot_ps(moving, oldY)));
+    }
+    steerTowardsScalar(x + i, y + i, speed + i, vx + i, vy + i, count - i, targetX, targetY);
+}
+
+__attribute__((target("avx2")))
+void steerAvx2(const float* x, const float* y, const float* speed, float* vx, float* vy,
+               std::size_t count, float targetX, float targetY) {
+    const __m256 tx = _mm256_set1_ps(targetX), ty = _mm256_set1_ps(targetY), zero = _mm256_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 dx = _mm256_sub_ps(tx, _mm256_loadu_ps(x + i));
+        __m256 dy = _mm256_sub_ps(ty, _mm256_loadu_ps(y + i));
+        __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+        __m256 moving = _mm256_cmp_ps(length, zero, _CMP_GT_OQ);
+        __m256 s = _mm256_loadu_ps(speed + i);
+        __m256 nx = _mm256_mul_ps(_mm256_div_ps(dx, length), s);
+        __m256 ny = _mm256_mul_ps(_mm256_div_ps(dy, length), s);
+        _mm256_storeu_ps(vx + i, _mm256_blendv_ps(_mm256_loadu_ps(vx + i), nx, moving));
+        _mm256_storeu_ps(vy + i, _mm256_blendv_ps(_mm256_loadu_ps(vy + i), ny, moving));
+    }
+    steerSse(x + i, y + i, speed + i, vx + i, vy + i, count - i, targetX, targetY);
+}
+
+typedef void (*SteerKernel)(const float*, const float*, const float*, float*, float*, std::size_t, float, float);
+
+struct Dispatch {
+    SteerKernel kernel;
+    const char* name;
+};
+
+Dispatch selectKernel() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return {steerAvx2, "avx2"};
+    if (__builtin_cpu_supports("sse2")) return {steerSse, "sse2"};
+    return {steerTowardsScalar, "scalar"};
+}
+
+const Dispatch& dispatch() {
+    static const Dispatch selected = selectKernel();
+    return selected;
+}
+
+}
+
+void steerTowards(const float* x, const float* y, const float* speed, float* vx, float* vy,
+                  std::size_t count, float targetX, float targetY) {
+    dispatch().kernel(x, y, speed, vx, vy, count, targetX, targetY);
+}
+
+const char* steeringKernelName() { return dispatch().name; }
+
+#else
+
+void steerTowards(const float* x, const float* y, const float* speed, float* vx, float* vy,
+                  std::size_t count, float targetX, float targetY) {
+    steerTowardsScalar(x, y, speed, vx, vy, count, targetX, targetY);
+}
+
+const char* steeringKernelName() { return "scalar"; }
+
+#endif
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+
+// Sets (vx, vy) for enemies [0, count) to point from (x, y) at the target at
+// each enemy's speed; an enemy exactly on the target keeps its old velocity.
+// Picks an AVX2 or SSE kernel at runtime where the CPU has one, otherwise a
+// scalar loop. Every path does the same correctly rounded float sqrt, divide
+// and multiply, so the results are bit-identical whichever one runs as long
+// as scalar float maths uses SSE too (the MakeFile passes -mfpmath=sse, which
+// 32-bit x86 builds need to keep x87 extended precision out of the loop).
+void steerTowards(const float* x, const float* y, const float* speed, float* vx, float* vy,
+                  std::size_t count, float targetX, float targetY);
+
+// Name of the kernel steerTowards dispatches to on this machine.
+const char* steeringKernelName();
+
+// The portable loop, exposed for benchmarks and cross-checking.
+void steerTowardsScalar(const float* x, const float* y, const float* speed, float* vx, float* vy,
+                        std::size_t count, float targetX, float targetY);
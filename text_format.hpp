@@ -0,0 +1,27 @@
+#pragma once
+
+// Allocation-free text building into caller-owned char buffers. Each append
+// writes at out, NUL-terminates and returns the new end for chaining; sizing
+// the buffer is the caller's job.
+
+inline char* appendText(char* out, const char* text) {
+    while (*text) *out++ = *text++;
+    *out = '\0';
+    return out;
+}
+
+// Writes value in decimal; needs room for 11 characters plus the terminator.
+inline char* appendInt(char* out, int value) {
+    char digits[10];
+    int count = 0;
+    unsigned magnitude = value < 0 ? 0u - static_cast<unsigned>(value) : static_cast<unsigned>(value);
+    do {
+        digits[count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    if (value < 0) *out++ = '-';
+    while (count > 0) *out++ = digits[--count];
+    *out = '\0';
+    return out;
+}
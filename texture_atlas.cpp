@@ -0,0 +1,67 @@
+#include "texture_atlas.hpp"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+const unsigned ATLAS_PADDING = 2;
+const unsigned ATLAS_MIN_SIZE = 64;
+
+}
+
+void TextureAtlas::add(const std::string& name, const sf::Image& image) {
+    regions.push_back({name, image, sf::IntRect()});
+}
+
+bool TextureAtlas::pack(unsigned size) {
+    std::vector<Region*> order;
+    for (Region& r : regions) order.push_back(&r);
+    std::stable_sort(order.begin(), order.end(), [](const Region* a, const Region* b) {
+        return a->image.getSize().y > b->image.getSize().y;
+    });
+
+    unsigned x = 0, y = 0, shelfHeight = 0;
+    for (Region* r : order) {
+        unsigned w = r->image.getSize().x + ATLAS_PADDING * 2;
+        unsigned h = r->image.getSize().y + ATLAS_PADDING * 2;
+        if (x + w > size) {
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+        if (x + w > size || y + h > size) return false;
+
+        r->rect = sf::IntRect(x + ATLAS_PADDING, y + ATLAS_PADDING, r->image.getSize().x, r->image.getSize().y);
+        x += w;
+        shelfHeight = std::max(shelfHeight, h);
+    }
+    return true;
+}
+
+bool TextureAtlas::build() {
+    unsigned maxSize = sf::Texture::getMaximumSize();
+    unsigned size = ATLAS_MIN_SIZE;
+    while (!pack(size)) {
+        if (size >= maxSize) {
+            std::cerr << "Sprite art does not fit in a " << maxSize << "x" << maxSize << " atlas\n";
+            return false;
+        }
+        size *= 2;
+    }
+
+    sf::Image atlas;
+    atlas.create(size, size, sf::Color::Transparent);
+    for (const Region& r : regions)
+        atlas.copy(r.image, r.rect.left, r.rect.top);
+
+    // The packed copy is all we need from here on
+    for (Region& r : regions) r.image = sf::Image();
+    return texture.loadFromImage(atlas);
+}
+
+sf::IntRect TextureAtlas::getRegion(const std::string& name) const {
+    for (const Region& r : regions) {
+        if (r.name == name) return r.rect;
+    }
+    return sf::IntRect();
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+// Packs separately loaded sprite images into one texture at startup so the
+// whole gameplay layer draws with a single texture bind. Images are placed
+// with a shelf packer (tallest first, left to right, new shelf when a row is
+// full) into the smallest power-of-two square that fits, with a transparent
+// gutter around each so filtering never bleeds between neighbours.
+class TextureAtlas {
+private:
+    struct Region {
+        std::string name;
+        sf::Image image;
+        sf::IntRect rect;
+    };
+
+    std::vector<Region> regions;
+    sf::Texture texture;
+
+    bool pack(unsigned size);
+
+public:
+    void add(const std::string& name, const sf::Image& image);
+    // Packs everything added so far and uploads the result. Returns false if
+    // it does not fit in the largest texture the GPU supports.
+    bool build();
+
+    const sf::Texture& getTexture() const { return texture; }
+    // The named image's rectangle in the atlas; empty if the name is unknown.
+    sf::IntRect getRegion(const std::string& name) const;
+};
@@ -0,0 +1,130 @@
+#include "thread_pool.hpp"
+#include <algorithm>
+
+namespace {
+
+// The pool and queue the current thread works for, if it is a worker
+thread_local const ThreadPool* currentPool = nullptr;
+thread_local std::size_t currentQueue = 0;
+
+}
+
+ThreadPool::ThreadPool(unsigned threads) : queued(0), nextQueue(0), stopping(false) {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    unsigned workerCount = threads - 1;
+    for (unsigned i = 0; i < workerCount; ++i) queues.emplace_back(new Queue());
+    for (unsigned i = 0; i < workerCount; ++i) workers.emplace_back(&ThreadPool::run, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) worker.join();
+}
+
+void ThreadPool::execute(const Task& task) {
+    task.run(task.context, task.begin, task.end);
+    task.group->pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void ThreadPool::push(std::size_t queue, const Task& task) {
+    std::lock_guard<std::mutex> lock(queues[queue]->mutex);
+    queues[queue]->tasks.push_back(task);
+    queued.fetch_add(1, std::memory_order_release);
+}
+
+void ThreadPool::notifyWorkers() {
+    // Taking the lock orders the queued increment before any sleeping
+    // worker's recheck, so a wakeup cannot be lost
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    wake.notify_all();
+}
+
+bool ThreadPool::findTask(Task& task) {
+    if (queued.load(std::memory_order_acquire) == 0) return false;
+
+    // Own queue first, newest task; it is the one most likely still in cache
+    bool onPool = currentPool == this;
+    if (onPool) {
+        Queue& own = *queues[currentQueue];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Then steal the oldest task from the others
+    std::size_t start = onPool ? currentQueue + 1 : 0;
+    for (std::size_t k = 0; k < queues.size(); ++k) {
+        Queue& victim = *queues[(start + k) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::run(std::size_t index) {
+    currentPool = this;
+    currentQueue = index;
+    for (;;) {
+        Task task;
+        if (findTask(task)) {
+            execute(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this] { return stopping || queued.load(std::memory_order_acquire) > 0; });
+        if (stopping) return;
+    }
+}
+
+void ThreadPool::submit(const Task& task) {
+    task.group->pending.fetch_add(1, std::memory_order_relaxed);
+    if (queues.empty()) {
+        execute(task);
+        return;
+    }
+    push(currentPool == this ? currentQueue : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size(), task);
+    notifyWorkers();
+}
+
+void ThreadPool::submitRange(void (*run)(void*, std::size_t, std::size_t), void* context, std::size_t count,
+                             std::size_t grain, TaskGroup& group) {
+    std::size_t chunks = (count + grain - 1) / grain;
+    group.pending.fetch_add(chunks, std::memory_order_relaxed);
+    if (queues.empty()) {
+        for (std::size_t begin = 0; begin < count; begin += grain) {
+            Task task = {run, context, begin, std::min(begin + grain, count), &group};
+            execute(task);
+        }
+        return;
+    }
+
+    // Neighbouring chunks go to the same worker; stealing rebalances
+    std::size_t perQueue = (chunks + queues.size() - 1) / queues.size();
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+        std::size_t begin = chunk * grain;
+        Task task = {run, context, begin, std::min(begin + grain, count), &group};
+        push(chunk / perQueue, task);
+    }
+    notifyWorkers();
+}
+
+void ThreadPool::wait(TaskGroup& group) {
+    while (!group.done()) {
+        Task task;
+        if (findTask(task)) execute(task);
+        else std::this_thread::yield();
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Tasks that are waited on together; wait() returns once all have run.
+class TaskGroup {
+private:
+    friend class ThreadPool;
+    std::atomic<std::size_t> pending;
+
+public:
+    TaskGroup() : pending(0) {}
+    bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+};
+
+// A unit of work: run(context, begin, end). Plain function pointer plus
+// context so submitting never allocates a closure.
+struct Task {
+    void (*run)(void* context, std::size_t begin, std::size_t end);
+    void* context;
+    std::size_t begin;
+    std::size_t end;
+    TaskGroup* group;
+};
+
+// Fixed set of worker threads, each with its own task deque. A worker takes
+// its newest task first and, when it runs dry, steals the oldest task from
+// another worker, so uneven chunks even out without a central queue. A
+// thread that waits on a group helps run tasks instead of blocking, so the
+// caller counts as one of the threads.
+class ThreadPool {
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;   // one per worker
+    std::vector<std::thread> workers;
+    std::atomic<std::size_t> queued;
+    std::atomic<std::size_t> nextQueue;
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping;
+
+    void run(std::size_t index);
+    bool findTask(Task& task);
+    void push(std::size_t queue, const Task& task);
+    void notifyWorkers();
+    static void execute(const Task& task);
+
+    template <typename Body>
+    static void invokeRange(void* context, std::size_t begin, std::size_t end) {
+        (*static_cast<Body*>(context))(begin, end);
+    }
+
+public:
+    // threads counts the calling thread; 0 uses every hardware thread.
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned getThreadCount() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+    void submit(const Task& task);
+    // Runs queued tasks on this thread until every task in group has finished.
+    void wait(TaskGroup& group);
+
+    // Calls body(begin, end) over [0, count) in chunks of grain items and
+    // returns when all are done. Chunk boundaries depend only on count and
+    // grain, never on the thread count, so element-wise work gives the same
+    // result on any machine. Small ranges run inline.
+    template <typename Body>
+    void parallelFor(std::size_t count, std::size_t grain, Body& body) {
+        if (count == 0) return;
+        if (count <= grain || workers.empty()) {
+            body(0, count);
+            return;
+        }
+        TaskGroup group;
+        submitRange(&ThreadPool::invokeRange<Body>, &body, count, grain, group);
+        wait(group);
+    }
+
+    // Queues the chunks of [0, count) as tasks of group, spread over the
+    // workers in contiguous runs.
+    void submitRange(void (*run)(void*, std::size_t, std::size_t), void* context, std::size_t count,
+                     std::size_t grain, TaskGroup& group);
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include <atomic>
+
+// Lock-free triple buffer for one writer thread and one reader thread. The
+// writer fills writeBuffer() and publishes it; the reader picks up the
+// newest published value with update(). Neither side ever waits, and values
+// the reader was too slow to see are simply skipped.
+template <typename T>
+class TripleBuffer {
+private:
+    static const unsigned INDEX_MASK = 3;
+    static const unsigned FRESH = 4;   // middle holds a value the reader has not taken
+
+    T slots[3];
+    std::atomic<unsigned> middle;   // slot in transit between the two sides
+    unsigned back;                  // owned by the writer
+    unsigned front;                 // owned by the reader
+
+public:
+    TripleBuffer() : middle(1), back(0), front(2) {}
+
+    // Direct access for setup before either thread starts.
+    T& slot(unsigned i) { return slots[i]; }
+
+    T& writeBuffer() { return slots[back]; }
+    void publish() { back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX_MASK; }
+
+    // Swaps in the newest published value; false if nothing new was published.
+    bool update() {
+        if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX_MASK;
+        return true;
+    }
+    const T& readBuffer() const { return slots[front]; }
+};
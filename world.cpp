@@ -0,0 +1,183 @@
+#include "world.hpp"
+#include "geometry.hpp"
+#include <algorithm>
+#include <cmath>
+
+Bullet::Bullet(float x, float y, float dirX, float dirY)
+    : previousPosition(x, y), position(x, y), speed(BULLET_SPEED) {
+    float length = std::sqrt(dirX * dirX + dirY * dirY);
+    if (length > 0) {
+        velocity.x = (dirX / length) * speed;
+        velocity.y = (dirY / length) * speed;
+    }
+}
+
+SafeZone::SafeZone()
+    : shrinkRate(SAFE_ZONE_SHRINK_RATE), minRadius(50.0f) {
+    radius = std::min(WINDOW_WIDTH, WINDOW_HEIGHT) * 0.5f;
+    previousRadius = radius;
+}
+
+void SafeZone::update(float dt) {
+    previousRadius = radius;
+    if (radius > minRadius) radius -= shrinkRate * dt;
+}
+
+bool SafeZone::isInside(const sf::Vector2f& position) const {
+    sf::Vector2f center = getCenter();
+    return pointInCircle(position.x, position.y, center.x, center.y, radius);
+}
+
+World::World(const WorldConfig& config)
+    : config(config), enemyGrid(COLLISION_CELL_SIZE, WINDOW_WIDTH, WINDOW_HEIGHT),
+      bullets(config.maxBullets), seed(config.seed), timeSinceLastSpawn(0.0f), timeSinceLastShot(BULLET_COOLDOWN),
+      score(0), killCount(0), ticks(0), profiler(nullptr), sounds(nullptr), pool(nullptr), tickDt(0.0f) {
+    enemies.allocate(config.maxEnemies);
+    enemyGrid.reserve(config.maxEnemies);
+
+    // Bullets and enemies touch disjoint state, so they can run side by side.
+    // Collision needs both, and the zone goes last so damage lands in the
+    // same order as a serial tick; the result never depends on the pool.
+    JobGraph::JobId bulletJob = tickGraph.add([this] { updateBullets(tickDt); });
+    JobGraph::JobId enemyJob = tickGraph.add([this] { updateEnemies(tickDt); });
+    JobGraph::JobId collisionJob = tickGraph.add([this] { resolveCollisions(); }, {bulletJob, enemyJob});
+    tickGraph.add([this] { updateSafeZone(tickDt); }, {collisionJob});
+
+    reset(config.seed);
+}
+
+void World::reset(std::uint64_t newSeed) {
+    // The containers keep their capacity, so this never allocates
+    seed = newSeed;
+    spawnRandom.reseed(seed, RandomStream::Spawn);
+    aiRandom.reseed(seed, RandomStream::Ai);
+    input = PlayerInput();
+    player = Player();
+    enemies.clear();
+    bullets.clear();
+    safeZone = SafeZone();
+    timeSinceLastSpawn = 0.0f;
+    timeSinceLastShot = BULLET_COOLDOWN;
+    score = 0;
+    killCount = 0;
+    ticks = 0;
+    for (int i = 0; i < config.initialEnemies; ++i) spawnEnemy();
+}
+
+void World::spawnEnemy() {
+    if (enemies.full()) return;
+    float x = static_cast<float>(spawnRandom.nextBelow(WINDOW_WIDTH));
+    float y = static_cast<float>(spawnRandom.nextBelow(WINDOW_HEIGHT));
+    float speedScale = 1.0f + static_cast<float>(aiRandom.nextBelow(20)) / 10.0f;
+    enemies.spawn(x, y, ENEMY_SPEED * speedScale, ENEMY_HEALTH);
+}
+
+void World::emitSound(SoundId id, float x, float y) {
+    if (!sounds) return;
+    SoundEvent event;
+    event.id = id;
+    event.x = x;
+    event.y = y;
+    // A full queue means the mixer is far behind; dropping the sound is fine
+    sounds->push(event);
+}
+
+void World::setInput(const PlayerInput& newInput) {
+    bool pendingFire = input.fire;
+    input = newInput;
+    input.fire = input.fire || pendingFire;
+}
+
+void World::step(float dt) {
+    ++ticks;
+    timeSinceLastSpawn += dt;
+    timeSinceLastShot += dt;
+
+    bool fireRequested = input.fire;
+    input.fire = false;
+    if (fireRequested && timeSinceLastShot > BULLET_COOLDOWN) {
+        sf::Vector2f playerPos = player.getPosition();
+        if (bullets.spawn(playerPos.x, playerPos.y, input.aim.x - playerPos.x, input.aim.y - playerPos.y)) {
+            timeSinceLastShot = 0.0f;
+            emitSound(SoundId::Shoot, playerPos.x, playerPos.y);
+        }
+    }
+
+    player.applyInput(input);
+    player.move(dt);
+
+    // Scheduling costs more than a small tick, so only hordes use the pool
+    tickDt = dt;
+    tickGraph.run(enemies.size() >= static_cast<std::size_t>(ENEMY_UPDATE_CHUNK) ? pool : nullptr);
+
+    if (timeSinceLastSpawn > config.spawnInterval && !enemies.full()) {
+        spawnEnemy();
+        timeSinceLastSpawn = 0.0f;
+    }
+}
+
+void World::updateBullets(float dt) {
+    ProfileScope scope(profiler, ProfilePhase::Bullets);
+    for (std::size_t i = 0; i < bullets.size(); ) {
+        bullets[i].move(dt);
+        sf::Vector2f pos = bullets[i].getPosition();
+        if (pos.x < 0 || pos.x > WINDOW_WIDTH || pos.y < 0 || pos.y > WINDOW_HEIGHT) {
+            bullets.removeAt(i);
+        } else ++i;
+    }
+}
+
+void World::updateEnemies(float dt) {
+    ProfileScope scope(profiler, ProfilePhase::Enemies);
+    sf::Vector2f playerPos = player.getPosition();
+    // Each enemy only touches its own slots, so chunks can run in any order
+    // on any thread and the result is the same as the serial loop
+    auto updateRange = [&](std::size_t begin, std::size_t end) {
+        enemies.steer(playerPos.x, playerPos.y, begin, end);
+        enemies.integrate(dt, begin, end);
+    };
+    if (pool) pool->parallelFor(enemies.size(), ENEMY_UPDATE_CHUNK, updateRange);
+    else updateRange(0, enemies.size());
+}
+
+void World::resolveCollisions() {
+    ProfileScope scope(profiler, ProfilePhase::Collision);
+
+    // Each bullet hits the lowest-index live enemy it overlaps, found through
+    // the grid instead of testing every bullet against every enemy.
+    if (!bullets.empty()) enemyGrid.build(enemies.x.data(), enemies.y.data(), enemies.size());
+    for (std::size_t b = 0; b < bullets.size(); ) {
+        sf::Vector2f bulletPos = bullets[b].getPosition();
+        float bulletRadius = bullets[b].getRadius();
+        int target = -1;
+        enemyGrid.query(bulletPos.x, bulletPos.y, bulletRadius + ENEMY_HIT_RADIUS, [&](int i) {
+            if (enemies.health[i] <= 0 || (target >= 0 && i > target)) return;
+            if (circlesOverlap(bulletPos.x, bulletPos.y, bulletRadius, enemies.x[i], enemies.y[i], ENEMY_HIT_RADIUS)) target = i;
+        });
+
+        if (target >= 0) {
+            enemies.health[target] -= 25;
+            if (enemies.health[target] <= 0) {
+                score += 10;
+                killCount++;
+                emitSound(SoundId::EnemyKilled, enemies.x[target], enemies.y[target]);
+            } else emitSound(SoundId::EnemyHit, enemies.x[target], enemies.y[target]);
+            bullets.removeAt(b);
+        } else ++b;
+    }
+
+    sf::Vector2f playerPos = player.getPosition();
+    std::size_t enemyCount = enemies.size();
+    for (std::size_t i = 0; i < enemyCount; ++i) {
+        if (enemies.health[i] <= 0) continue;
+        // Contact and zone damage are per tick, i.e. SIM_TICK_RATE per second
+        if (pointInCircle(enemies.x[i], enemies.y[i], playerPos.x, playerPos.y, PLAYER_CONTACT_RADIUS)) player.takeDamage(1);
+    }
+    enemies.removeDead();
+}
+
+void World::updateSafeZone(float dt) {
+    ProfileScope scope(profiler, ProfilePhase::SafeZone);
+    safeZone.update(dt);
+    if (!safeZone.isInside(player.getPosition())) player.takeDamage(1);
+}
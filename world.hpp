@@ -0,0 +1,179 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include "config.hpp"
+#include "enemy_store.hpp"
+#include "job_graph.hpp"
+#include "pool.hpp"
+#include "profiler.hpp"
+#include "random.hpp"
+#include "sound_event.hpp"
+#include "spatial_hash.hpp"
+#include "thread_pool.hpp"
+
+// Everything the simulation needs from the player for one tick. Filled from
+// the keyboard/mouse by the windowed game and by the autopilot when headless.
+struct PlayerInput {
+    bool up = false;
+    bool down = false;
+    bool left = false;
+    bool right = false;
+    bool fire = false;
+    sf::Vector2f aim;
+};
+
+inline sf::Vector2f lerp(const sf::Vector2f& a, const sf::Vector2f& b, float t) {
+    return a + (b - a) * t;
+}
+
+class Entity {
+protected:
+    sf::Vector2f previousPosition;
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    float speed;
+    int health;
+
+public:
+    Entity(float x, float y, float speed, int health)
+        : previousPosition(x, y), position(x, y), speed(speed), health(health) {}
+
+    void move(float dt) {
+        previousPosition = position;
+        position += velocity * dt;
+    }
+    bool isAlive() const { return health > 0; }
+    void takeDamage(int amount) { health -= amount; }
+    sf::Vector2f getPosition() const { return position; }
+    sf::Vector2f getInterpolatedPosition(float alpha) const { return lerp(previousPosition, position, alpha); }
+    int getHealth() const { return health; }
+};
+
+class Player : public Entity {
+public:
+    Player() : Entity(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2, PLAYER_SPEED, 100) {}
+
+    void applyInput(const PlayerInput& input) {
+        velocity = {0, 0};
+        if (input.up) velocity.y -= speed;
+        if (input.down) velocity.y += speed;
+        if (input.left) velocity.x -= speed;
+        if (input.right) velocity.x += speed;
+    }
+};
+
+class Bullet {
+private:
+    sf::Vector2f previousPosition;
+    sf::Vector2f position;
+    sf::Vector2f velocity;
+    float speed;
+
+public:
+    Bullet(float x, float y, float dirX, float dirY);
+
+    void move(float dt) {
+        previousPosition = position;
+        position += velocity * dt;
+    }
+    sf::Vector2f getPosition() const { return position; }
+    sf::Vector2f getInterpolatedPosition(float alpha) const { return lerp(previousPosition, position, alpha); }
+    float getRadius() const { return BULLET_RADIUS; }
+};
+
+class SafeZone {
+private:
+    float shrinkRate;
+    float minRadius;
+    float previousRadius;
+    float radius;
+
+public:
+    SafeZone();
+
+    void update(float dt);
+    bool isInside(const sf::Vector2f& position) const;
+    sf::Vector2f getCenter() const { return sf::Vector2f(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2); }
+    float getRadius() const { return radius; }
+    float getInterpolatedRadius(float alpha) const { return previousRadius + (radius - previousRadius) * alpha; }
+};
+
+// Match tuning; the defaults are the normal game, headless runs raise the
+// enemy counts for horde workloads. The caps also size the entity storage,
+// which is allocated once when the World is built.
+struct WorldConfig {
+    int initialEnemies = INITIAL_ENEMIES;
+    int maxEnemies = MAX_ENEMIES;
+    int maxBullets = MAX_BULLETS;
+    float spawnInterval = ENEMY_SPAWN_INTERVAL;
+    std::uint64_t seed = 0;   // seed of the first match
+};
+
+// The whole match state, advanced in fixed ticks with no dependency on a
+// window, textures or audio so it can run headless. Entities keep their
+// previous-tick position so the renderer can interpolate between ticks.
+class World {
+private:
+    WorldConfig config;
+    PlayerInput input;
+    Player player;
+    EnemyStore enemies;
+    SpatialHash enemyGrid;
+    FixedPool<Bullet> bullets;
+    SafeZone safeZone;
+    std::uint64_t seed;
+    Random spawnRandom;
+    Random aiRandom;
+    float timeSinceLastSpawn;
+    float timeSinceLastShot;
+    int score;
+    int killCount;
+    unsigned ticks;
+    Profiler* profiler;
+    SoundQueue* sounds;
+    ThreadPool* pool;
+    JobGraph tickGraph;
+    float tickDt;
+
+    void spawnEnemy();
+    void emitSound(SoundId id, float x, float y);
+    void updateBullets(float dt);
+    void updateEnemies(float dt);
+    void resolveCollisions();
+    void updateSafeZone(float dt);
+
+public:
+    explicit World(const WorldConfig& config = WorldConfig());
+    // The tick graph's jobs point back at this World
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // Starts a new match in place with the same config, reusing the entity
+    // storage. The profiler and sound queue stay attached. The same seed and
+    // inputs always replay the same match.
+    void reset(std::uint64_t newSeed);
+
+    // Input stays in effect for every following tick; a fire request is
+    // consumed by the first tick that sees it.
+    void setInput(const PlayerInput& newInput);
+    // The input the next tick will run with, pending fire included.
+    const PlayerInput& getInput() const { return input; }
+    void step(float dt);
+    // Times each simulation phase into the profiler; null switches it off.
+    void setProfiler(Profiler* newProfiler) { profiler = newProfiler; }
+    // Sound requests are pushed here for the audio mixer; null drops them.
+    void setSoundQueue(SoundQueue* queue) { sounds = queue; }
+    // Large hordes update their enemies in parallel on this pool; null keeps
+    // everything on the calling thread. Results do not depend on it.
+    void setThreadPool(ThreadPool* newPool) { pool = newPool; }
+
+    const WorldConfig& getConfig() const { return config; }
+    const Player& getPlayer() const { return player; }
+    const EnemyStore& getEnemies() const { return enemies; }
+    const FixedPool<Bullet>& getBullets() const { return bullets; }
+    const SafeZone& getSafeZone() const { return safeZone; }
+    int getScore() const { return score; }
+    int getKillCount() const { return killCount; }
+    unsigned getTicks() const { return ticks; }
+    std::uint64_t getSeed() const { return seed; }
+    bool isOver() const { return !player.isAlive(); }
+};